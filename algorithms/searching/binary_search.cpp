@@ -0,0 +1,89 @@
+/*
+ * @file
+ *
+ * @brief Implements Binary Search Algorithm (Iterative)
+ *
+ * Algorithm:
+ * 1. Look at the middle element of the sorted search space
+ * 2. If it matches the requested one, return its index
+ * 3. If it is lesser than the requested one, discard the left half, otherwise discard the right half
+ * 4. Repeat till the search space is empty, then return -1
+ */
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+/*
+ * @namespace algorithms
+ * @brief Parent namespace for all namespaces of various algorithms
+ */
+namespace algorithms {
+
+/*
+ * @namespace search
+ * @brief Functions for searching algorithms
+ */
+namespace search {
+
+/*
+ * @brief Looks for @param item in the sorted range [@param first, @param last)
+ *        using Binary Search. Usable in constant expressions.
+ *
+ * @param first Iterator to the beginning of the range
+ * @param last Iterator past the end of the range
+ * @param item Item to be searched for
+ */
+template <typename Iterator, typename T>
+constexpr std::size_t binarySearch(Iterator first, Iterator last, const T& item) {
+    std::size_t low = 0, high = last - first;
+
+    while (low < high) {
+        std::size_t mid = low + (high - low) / 2;
+
+        if (first[mid] < item) low = mid + 1;
+        else if (item < first[mid]) high = mid;
+        else return mid;
+    }
+
+    return -1;
+}
+
+/*
+ * @brief Looks for @param item in the sorted @param array using Binary Search
+ *
+ * @param array Array to be searched
+ * @param size Size of the array
+ * @param item Item to be searched for
+ */
+template <typename T>
+constexpr std::size_t binarySearch(const T *array, std::size_t size, const T& item) {
+    return binarySearch(array, array + size, item);
+}
+
+/*
+ * @brief Looks for @param item in the sorted @param array using Binary Search.
+ *        Usable in constant expressions.
+ *
+ * @param array Array to be searched
+ * @param item Item to be searched for
+ */
+template <typename T, std::size_t N>
+constexpr std::size_t binarySearch(const std::array<T, N>& array, const T& item) {
+    return binarySearch(array.begin(), array.end(), item);
+}
+
+/*
+ * @brief Looks for @param item in the sorted @param array using Binary Search
+ *
+ * @param array Array to be searched
+ * @param item Item to be searched for
+ */
+template <typename T>
+std::size_t binarySearch(const std::vector<T>& array, const T& item) {
+    return binarySearch(array.begin(), array.end(), item);
+}
+
+} // namespace search
+
+} // namespace algorithms
@@ -10,6 +10,7 @@
  * 4. If loop finishes, no element matching the requested one is found, return -1
  */
 
+#include <array>
 #include <cstddef>
 #include <vector>
 
@@ -56,6 +57,34 @@ std::size_t linearSeach(std::vector<T> array, T item) {
     return -1;
 }
 
+/* 
+ * @brief Looks for @param item in the range [@param first, @param last)
+ *        using Linear Search. Usable in constant expressions.
+ * 
+ * @param first Iterator to the beginning of the range
+ * @param last Iterator past the end of the range
+ * @param item Item to be searched for
+ */
+template <typename Iterator, typename T>
+constexpr std::size_t linearSeach(Iterator first, Iterator last, const T& item) {
+    for (std::size_t i = 0; first != last; ++first, ++i) {
+        if (*first == item) return i;
+    }
+
+    return -1;
+}
+
+/* 
+ * @brief Looks for @param item in @param array using Linear Search.
+ *        Usable in constant expressions.
+ * 
+ * @param array Array to be searched
+ * @param item Item to be searched for
+ */
+template <typename T, std::size_t N>
+constexpr std::size_t linearSeach(const std::array<T, N>& array, const T& item) {
+    return linearSeach(array.begin(), array.end(), item);
+}
 
 } // namespace search
 
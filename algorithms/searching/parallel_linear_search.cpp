@@ -0,0 +1,481 @@
+/*
+ * @file
+ *
+ * @brief Implements Parallel Linear Search Algorithm (Multi-threaded)
+ *
+ * Algorithm:
+ * 1. Split the array into cache line aligned chunks
+ * 2. Workers claim chunks in ascending order from a shared counter
+ * 3. Each worker scans its chunk a cache line at a time, comparing the whole line at once
+ *    (with SSE2 for integers, float and double)
+ * 4. A hit is published to a shared atomic minimum index
+ * 5. Workers stop claiming and scanning once the chunk lies past the published minimum,
+ *    so the lowest matching index is still returned
+ *
+ * The worker threads are started on first use and kept for later searches.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/*
+ * @namespace algorithms
+ * @brief Parent namespace for all namespaces of various algorithms
+ */
+namespace algorithms {
+
+/*
+ * @namespace search
+ * @brief Functions for searching algorithms
+ */
+namespace search {
+
+/*
+ * @namespace parallel
+ * @brief Helpers of the parallel searching algorithms
+ */
+namespace parallel {
+
+/*
+ * @brief Size of a cache line in bytes
+ */
+constexpr std::size_t CACHE_LINE = 64;
+
+/*
+ * @brief Bytes scanned by a worker per claimed chunk
+ */
+constexpr std::size_t CHUNK_BYTES = 64 * 1024;
+
+/*
+ * @brief Arrays smaller than this many bytes are searched on the calling thread.
+ *        Waking the pooled workers and waiting for them costs tens of microseconds,
+ *        about as long as scanning 1 MiB on one core, so smaller arrays gain nothing
+ *        from more threads. Tune with benchmarks/parallel_linear_search_benchmark.cpp.
+ */
+constexpr std::size_t SEQUENTIAL_BYTES = 1024 * 1024;
+
+/*
+ * @brief Splits an array into chunks whose boundaries (apart from the first one)
+ *        start on a cache line
+ */
+template <typename T>
+struct Chunks {
+    std::size_t first;
+    std::size_t width;
+    std::size_t count;
+
+    Chunks(const T *array, std::size_t size) {
+        width = std::max<std::size_t>(1, CHUNK_BYTES / sizeof(T));
+
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(array);
+        std::size_t misalignment = (CACHE_LINE - address % CACHE_LINE) % CACHE_LINE;
+
+        first = (misalignment % sizeof(T) == 0) ? misalignment / sizeof(T) : 0;
+        first = std::min(size, first == 0 ? width : first);
+        count = 1 + (size - first + width - 1) / width;
+    }
+
+    std::size_t begin(std::size_t chunk) const {
+        return chunk == 0 ? 0 : first + (chunk - 1) * width;
+    }
+
+    std::size_t end(std::size_t chunk, std::size_t size) const {
+        return std::min(size, first + chunk * width);
+    }
+};
+
+/*
+ * @brief Number of worker threads to use for @param size elements of @param T
+ */
+template <typename T>
+unsigned workerCount(std::size_t size, unsigned threads) {
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    if (size * sizeof(T) < SEQUENTIAL_BYTES) return 1;
+
+    return threads;
+}
+
+/*
+ * @brief Threads kept alive between searches, so a search does not pay for
+ *        starting and joining threads. The pool grows to the largest number of
+ *        threads asked for and never shrinks. Only one search runs on the pool at
+ *        a time, searches from other threads wait for it to finish.
+ */
+class WorkerPool {
+    private:
+        std::mutex runMutex;
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable done;
+        std::vector<std::thread> threads;
+
+        // The current job, and how many pool threads take part in it
+        void (*invoke)(void *) = nullptr;
+        void *context = nullptr;
+        std::size_t generation = 0;
+        unsigned wanted = 0;
+        unsigned claimed = 0;
+        unsigned running = 0;
+        bool stopping = false;
+
+        void _work() {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            std::size_t seen = 0;
+
+            while (true) {
+                this->wake.wait(lock, [&]() {
+                    return this->stopping || (this->generation != seen && this->claimed < this->wanted);
+                });
+                if (this->stopping) return;
+
+                seen = this->generation;
+                ++this->claimed;
+
+                void (*invoke)(void *) = this->invoke;
+                void *context = this->context;
+
+                lock.unlock();
+                invoke(context);
+                lock.lock();
+
+                if (--this->running == 0) this->done.notify_all();
+            }
+        }
+
+    public:
+        WorkerPool() = default;
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        /*
+         * @brief The pool shared by all searches
+         */
+        static WorkerPool& instance() {
+            static WorkerPool pool;
+            return pool;
+        }
+
+        /*
+         * @brief Runs @param worker on @param count threads, one of them being the
+         *        calling thread, and returns once all of them are done
+         */
+        template <typename Worker>
+        void run(unsigned count, Worker& worker) {
+            if (count <= 1) {
+                worker();
+                return;
+            }
+
+            std::lock_guard<std::mutex> serial(this->runMutex);
+            std::unique_lock<std::mutex> lock(this->mutex);
+
+            while (this->threads.size() < count - 1) this->threads.emplace_back([this]() { _work(); });
+
+            this->invoke = [](void *context) { (*static_cast<Worker *>(context))(); };
+            this->context = &worker;
+            this->wanted = count - 1;
+            this->claimed = 0;
+            this->running = count - 1;
+            ++this->generation;
+
+            lock.unlock();
+            this->wake.notify_all();
+
+            worker();
+
+            lock.lock();
+            this->done.wait(lock, [&]() { return this->running == 0; });
+        }
+
+        ~WorkerPool() {
+            {
+                std::lock_guard<std::mutex> lock(this->mutex);
+                this->stopping = true;
+            }
+
+            this->wake.notify_all();
+            for (auto& thread: this->threads) thread.join();
+        }
+};
+
+/*
+ * @brief Runs @param worker on @param threads threads, one of them being the calling thread
+ */
+template <typename Worker>
+void runWorkers(unsigned threads, Worker worker) {
+    WorkerPool::instance().run(threads, worker);
+}
+
+#if defined(__SSE2__)
+/*
+ * @brief Returns if @param T can be compared for equality with the SSE2 lane compares
+ */
+template <typename T>
+constexpr bool sseComparable = (std::is_integral_v<T> && sizeof(T) <= 8) ||
+                               std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+/*
+ * @brief Compares the lanes of @param values and @param needle, setting every byte
+ *        of the lanes that are equal
+ */
+template <typename T>
+inline __m128i equalLanes(__m128i values, __m128i needle) {
+    if constexpr (std::is_same_v<T, float>) {
+        return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(values), _mm_castsi128_ps(needle)));
+    } else if constexpr (std::is_same_v<T, double>) {
+        return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(values), _mm_castsi128_pd(needle)));
+    } else if constexpr (sizeof(T) == 1) {
+        return _mm_cmpeq_epi8(values, needle);
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm_cmpeq_epi16(values, needle);
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm_cmpeq_epi32(values, needle);
+    } else {
+        // SSE2 has no 64 bit compare, both 32 bit halves have to match
+        __m128i halves = _mm_cmpeq_epi32(values, needle);
+        return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+}
+#endif
+
+/*
+ * @brief Returns the start of the first block of @param BLOCK elements in
+ *        [@param begin, @param end) that holds @param item, or the start of the
+ *        incomplete block at the end if none does
+ *
+ * Integers, float and double are compared with SSE2 where available, anything else
+ * by counting the matches without branching.
+ */
+template <std::size_t BLOCK, typename T>
+std::size_t findBlock(const T *array, std::size_t begin, std::size_t end, const T item) {
+    std::size_t i = begin;
+
+#if defined(__SSE2__)
+    if constexpr (sseComparable<T>) {
+        constexpr std::size_t LANES = 16 / sizeof(T);
+
+        T lanes[LANES];
+        std::fill(lanes, lanes + LANES, item);
+        __m128i needle = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lanes));
+
+        for (; i + BLOCK <= end; i += BLOCK) {
+            __m128i hits = _mm_setzero_si128();
+
+            for (std::size_t k = 0; k < BLOCK; k += LANES) {
+                __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(array + i + k));
+                hits = _mm_or_si128(hits, equalLanes<T>(values, needle));
+            }
+
+            if (_mm_movemask_epi8(hits)) break;
+        }
+
+        return i;
+    }
+#endif
+
+    for (; i + BLOCK <= end; i += BLOCK) {
+        unsigned hits = 0;
+        for (std::size_t k = 0; k < BLOCK; ++k) hits += (array[i + k] == item);
+
+        if (hits) break;
+    }
+
+    return i;
+}
+
+/*
+ * @brief Returns the index of the first @param item in [@param begin, @param end),
+ *        or @param end if it is not there
+ *
+ * Whole cache lines are compared at once, and only a line with a hit is
+ * scanned again for the exact index.
+ */
+template <typename T>
+std::size_t scan(const T *array, std::size_t begin, std::size_t end, const T& item) {
+    constexpr std::size_t BLOCK = CACHE_LINE / sizeof(T) > 4 ? CACHE_LINE / sizeof(T) : 4;
+
+    std::size_t i = findBlock<BLOCK>(array, begin, end, item);
+
+    for (; i < end; ++i) {
+        if (array[i] == item) return i;
+    }
+
+    return end;
+}
+
+/*
+ * @brief Atomically lowers @param minimum to @param index
+ */
+inline void publishMinimum(std::atomic<std::size_t>& minimum, std::size_t index) {
+    std::size_t current = minimum.load(std::memory_order_relaxed);
+
+    while (index < current && !minimum.compare_exchange_weak(current, index, std::memory_order_relaxed));
+}
+
+} // namespace parallel
+
+/*
+ * @brief Looks for the first @param item in @param array using Linear Search
+ *        spread over several threads
+ *
+ * @param array Array to be searched
+ * @param size Size of the array
+ * @param item Item to be searched for
+ * @param threads Number of threads to use, 0 uses every hardware thread
+ */
+template <typename T>
+std::size_t parallelLinearSearch(const T *array, std::size_t size, const T& item, unsigned threads = 0) {
+    threads = parallel::workerCount<T>(size, threads);
+
+    if (threads == 1) {
+        std::size_t index = parallel::scan(array, 0, size, item);
+        return index == size ? -1 : index;
+    }
+
+    parallel::Chunks<T> chunks(array, size);
+    std::atomic<std::size_t> nextChunk{0};
+    std::atomic<std::size_t> found{size};
+
+    parallel::runWorkers(threads, [&]() {
+        while (true) {
+            std::size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= chunks.count) return;
+
+            std::size_t begin = chunks.begin(chunk);
+            if (begin >= found.load(std::memory_order_relaxed)) return;
+
+            std::size_t end = chunks.end(chunk, size);
+            std::size_t index = parallel::scan(array, begin, end, item);
+
+            if (index != end) {
+                parallel::publishMinimum(found, index);
+                return;
+            }
+        }
+    });
+
+    std::size_t index = found.load();
+    return index == size ? -1 : index;
+}
+
+/*
+ * @brief Looks for the first @param item in @param array using Linear Search
+ *        spread over several threads
+ *
+ * @param array Array to be searched
+ * @param item Item to be searched for
+ * @param threads Number of threads to use, 0 uses every hardware thread
+ */
+template <typename T>
+std::size_t parallelLinearSearch(const std::vector<T>& array, const T& item, unsigned threads = 0) {
+    return parallelLinearSearch(array.data(), array.size(), item, threads);
+}
+
+/*
+ * @brief Counts the occurrences of @param item in @param array using several threads
+ *
+ * @param array Array to be searched
+ * @param size Size of the array
+ * @param item Item to be counted
+ * @param threads Number of threads to use, 0 uses every hardware thread
+ */
+template <typename T>
+std::size_t parallelCount(const T *array, std::size_t size, const T& item, unsigned threads = 0) {
+    threads = parallel::workerCount<T>(size, threads);
+
+    parallel::Chunks<T> chunks(array, size);
+    std::atomic<std::size_t> nextChunk{0};
+    std::atomic<std::size_t> total{0};
+
+    parallel::runWorkers(threads, [&]() {
+        std::size_t count = 0;
+
+        while (true) {
+            std::size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= chunks.count) break;
+
+            std::size_t end = chunks.end(chunk, size);
+            for (std::size_t i = chunks.begin(chunk); i < end; ++i) count += (array[i] == item);
+        }
+
+        total.fetch_add(count, std::memory_order_relaxed);
+    });
+
+    return total.load();
+}
+
+/*
+ * @brief Counts the occurrences of @param item in @param array using several threads
+ *
+ * @param array Array to be searched
+ * @param item Item to be counted
+ * @param threads Number of threads to use, 0 uses every hardware thread
+ */
+template <typename T>
+std::size_t parallelCount(const std::vector<T>& array, const T& item, unsigned threads = 0) {
+    return parallelCount(array.data(), array.size(), item, threads);
+}
+
+/*
+ * @brief Returns every index of @param item in @param array in ascending order,
+ *        searching with several threads
+ *
+ * @param array Array to be searched
+ * @param size Size of the array
+ * @param item Item to be searched for
+ * @param threads Number of threads to use, 0 uses every hardware thread
+ */
+template <typename T>
+std::vector<std::size_t> parallelFindAll(const T *array, std::size_t size, const T& item, unsigned threads = 0) {
+    threads = parallel::workerCount<T>(size, threads);
+
+    parallel::Chunks<T> chunks(array, size);
+    std::atomic<std::size_t> nextChunk{0};
+    std::vector<std::vector<std::size_t>> hits(chunks.count);
+
+    parallel::runWorkers(threads, [&]() {
+        while (true) {
+            std::size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= chunks.count) return;
+
+            std::size_t begin = chunks.begin(chunk), end = chunks.end(chunk, size);
+
+            while ((begin = parallel::scan(array, begin, end, item)) != end) {
+                hits[chunk].push_back(begin++);
+            }
+        }
+    });
+
+    std::vector<std::size_t> indices;
+    for (auto& chunk: hits) indices.insert(indices.end(), chunk.begin(), chunk.end());
+
+    return indices;
+}
+
+/*
+ * @brief Returns every index of @param item in @param array in ascending order,
+ *        searching with several threads
+ *
+ * @param array Array to be searched
+ * @param item Item to be searched for
+ * @param threads Number of threads to use, 0 uses every hardware thread
+ */
+template <typename T>
+std::vector<std::size_t> parallelFindAll(const std::vector<T>& array, const T& item, unsigned threads = 0) {
+    return parallelFindAll(array.data(), array.size(), item, threads);
+}
+
+} // namespace search
+
+} // namespace algorithms
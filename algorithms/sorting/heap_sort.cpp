@@ -0,0 +1,95 @@
+/*
+ * @file
+ *
+ * @brief Implements Heap Sort Algorithm (Iterative, d-ary Heap)
+ *
+ * Algorithm:
+ * 1. Build a max heap in-place where every node has D children (4 by default)
+ * 2. Swap the maximum at the root with the last element of the heap
+ * 3. Shrink the heap by one and sift the new root down to restore it
+ * 4. Repeat till the heap is empty
+ *
+ * Like Selection Sort it repeatedly moves the extreme element into place, but finding
+ * it costs O(log n) instead of O(n). A wider heap is shallower, so a sift compares
+ * more children per level but visits fewer levels, and the D children of a node are
+ * contiguous. The children of node i start at D * i + 1, which is the layout of
+ * data_structures::d_ary_heap::DAryHeap without its padding. The array is sorted
+ * where it is, so unlike DAryHeap its sibling groups are not aligned to cache lines
+ * and a group can straddle two of them.
+ */
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/*
+ * @namespace algorithms
+ * @brief Parent namespace for all namespaces of various algorithms
+ */
+namespace algorithms {
+
+/* 
+ * @namespace sort
+ * @brief Functions for sorting algorithms
+ */
+namespace sort {
+
+/* 
+ * @brief Sifts the element at @param root of the max heap @param array of
+ *        @param size elements down to its position
+ */
+template <std::size_t D = 4, typename T>
+void siftDown(T *array, std::size_t size, std::size_t root) {
+    T value = std::move(array[root]);
+
+    while (true) {
+        std::size_t first = D * root + 1;
+        if (first >= size) break;
+
+        std::size_t last = first + D < size ? first + D : size;
+        std::size_t largest = first;
+
+        for (std::size_t child = first + 1; child < last; ++child) {
+            if (array[largest] < array[child]) largest = child;
+        }
+
+        if (!(value < array[largest])) break;
+
+        array[root] = std::move(array[largest]);
+        root = largest;
+    }
+
+    array[root] = std::move(value);
+}
+
+/* 
+ * @brief Applies Heap Sort in-place on @param array
+ * 
+ * @param array Array to be sorted
+ * @param size Size of the array
+ */
+template <std::size_t D = 4, typename T>
+void heapSort(T *array, std::size_t size) {
+    if (size <= 1) return;
+
+    for (std::size_t root = (size - 2) / D + 1; root-- > 0;) siftDown<D>(array, size, root);
+
+    for (std::size_t end = size - 1; end > 0; --end) {
+        std::swap(array[0], array[end]);
+        siftDown<D>(array, end, 0);
+    }
+}
+
+/* 
+ * @brief Applies Heap Sort in-place on @param array
+ * 
+ * @param array Array to be sorted
+ */
+template <std::size_t D = 4, typename T>
+void heapSort(std::vector<T>& array) {
+    heapSort<D>(array.data(), array.size());
+}
+
+} // namespace sort
+
+} // namespace algorithms
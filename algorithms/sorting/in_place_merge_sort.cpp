@@ -0,0 +1,166 @@
+/*
+ * @file
+ *
+ * @brief Implements In-Place Stable Merge Sort Algorithm (Bottom-Up)
+ *
+ * Algorithm:
+ * 1. Sort small blocks of the array using Insertion Sort
+ * 2. Merge neighbouring blocks, doubling the block width every pass
+ * 3. If the smaller half of a merge fits in the scratch buffer, merge through the buffer
+ * 4. Otherwise split both halves around a pivot, rotate the middle pieces into place
+ *    and merge the two smaller problems the same way
+ *
+ * Without a buffer only O(log n) stack space is used. A fixed buffer of around
+ * sqrt(n) elements lets most of the small merges skip the rotations.
+ */
+
+#ifndef ALGORITHMS_SORTING_IN_PLACE_MERGE_SORT
+#define ALGORITHMS_SORTING_IN_PLACE_MERGE_SORT
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "insertion_sort.cpp"
+
+/*
+ * @namespace algorithms
+ * @brief Parent namespace for all namespaces of various algorithms
+ */
+namespace algorithms {
+
+/*
+ * @namespace sort
+ * @brief Functions for sorting algorithms
+ */
+namespace sort {
+
+/*
+ * @brief Width of the blocks sorted with Insertion Sort before merging starts
+ */
+constexpr std::size_t IN_PLACE_MERGE_BLOCK = 16;
+
+/*
+ * @brief Stable merge of the sorted ranges [@param first, @param middle) and
+ *        [@param middle, @param last), using at most @param bufferSize elements of
+ *        @param buffer as scratch space
+ *
+ * @param first Iterator to the beginning of the left range
+ * @param middle Iterator to the beginning of the right range
+ * @param last Iterator past the end of the right range
+ * @param buffer Scratch space, may be nullptr if @param bufferSize is 0
+ * @param bufferSize Number of elements available in @param buffer
+ */
+template <typename Iterator, typename T>
+void inPlaceMerge(Iterator first, Iterator middle, Iterator last, T *buffer, std::size_t bufferSize) {
+    std::size_t leftSize = middle - first, rightSize = last - middle;
+
+    if (leftSize == 0 || rightSize == 0) return;
+    if (!(*middle < *(middle - 1))) return;
+
+    if (leftSize <= bufferSize) {
+        std::move(first, middle, buffer);
+
+        T *i = buffer, *leftEnd = buffer + leftSize;
+        Iterator j = middle, out = first;
+
+        while (i != leftEnd && j != last) {
+            if (*j < *i) *(out++) = std::move(*(j++));
+            else *(out++) = std::move(*(i++));
+        }
+
+        std::move(i, leftEnd, out);
+        return;
+    }
+
+    if (rightSize <= bufferSize) {
+        std::move(middle, last, buffer);
+
+        T *j = buffer + rightSize;
+        Iterator i = middle, out = last;
+
+        while (i != first && j != buffer) {
+            if (*(j - 1) < *(i - 1)) *(--out) = std::move(*(--i));
+            else *(--out) = std::move(*(--j));
+        }
+
+        std::move_backward(buffer, j, out);
+        return;
+    }
+
+    if (leftSize + rightSize == 2) {
+        std::iter_swap(first, middle);
+        return;
+    }
+
+    Iterator leftCut, rightCut;
+
+    if (leftSize > rightSize) {
+        leftCut = first + leftSize / 2;
+        rightCut = std::lower_bound(middle, last, *leftCut);
+    } else {
+        rightCut = middle + rightSize / 2;
+        leftCut = std::upper_bound(first, middle, *rightCut);
+    }
+
+    Iterator newMiddle = std::rotate(leftCut, middle, rightCut);
+
+    inPlaceMerge(first, leftCut, newMiddle, buffer, bufferSize);
+    inPlaceMerge(newMiddle, rightCut, last, buffer, bufferSize);
+}
+
+/*
+ * @brief Applies stable In-Place Merge Sort on the range [@param first, @param last)
+ *
+ * @param first Iterator to the beginning of the range
+ * @param last Iterator past the end of the range
+ * @param buffer Scratch space, may be nullptr if @param bufferSize is 0
+ * @param bufferSize Number of elements available in @param buffer
+ */
+template <typename Iterator, typename T>
+void inPlaceMergeSort(Iterator first, Iterator last, T *buffer, std::size_t bufferSize) {
+    std::size_t size = last - first;
+
+    for (std::size_t start = 0; start < size; start += IN_PLACE_MERGE_BLOCK) {
+        insertionSort(first + start, first + std::min(start + IN_PLACE_MERGE_BLOCK, size));
+    }
+
+    for (std::size_t width = IN_PLACE_MERGE_BLOCK; width < size; width *= 2) {
+        for (std::size_t start = 0; start + width < size; start += 2 * width) {
+            inPlaceMerge(first + start, first + start + width,
+                         first + std::min(start + 2 * width, size), buffer, bufferSize);
+        }
+    }
+}
+
+/*
+ * @brief Applies stable In-Place Merge Sort on @param array using O(1) extra memory
+ *        (apart from O(log n) stack space)
+ *
+ * @param array Array to be sorted
+ */
+template <typename T>
+void inPlaceMergeSort(std::vector<T>& array) {
+    inPlaceMergeSort(array.begin(), array.end(), static_cast<T *>(nullptr), 0);
+}
+
+/*
+ * @brief Applies stable In-Place Merge Sort on @param array, using the elements of
+ *        @param buffer as scratch space. The buffer is never resized, and its
+ *        contents are unspecified afterwards. About sqrt(array.size()) elements
+ *        is enough to avoid most of the rotations.
+ *
+ * @param array Array to be sorted
+ * @param buffer Fixed size scratch space
+ */
+template <typename T>
+void inPlaceMergeSort(std::vector<T>& array, std::vector<T>& buffer) {
+    inPlaceMergeSort(array.begin(), array.end(), buffer.data(), buffer.size());
+}
+
+} // namespace sort
+
+} // namespace algorithms
+
+#endif // ALGORITHMS_SORTING_IN_PLACE_MERGE_SORT
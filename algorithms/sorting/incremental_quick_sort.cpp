@@ -0,0 +1,205 @@
+/*
+ * @file
+ *
+ * @brief Implements Incremental Quick Sort Algorithm (Lazy, Iterative)
+ *
+ * Algorithm:
+ * 1. Keep a stack of segment ends, each segment holding elements not greater than the next one
+ * 2. To emit the next element, partition the segment at the front around a pivot
+ *    (median of three) until the front segment is small or all equal to the pivot
+ * 3. Sort a small front segment with Insertion Sort
+ * 4. Emit the front element and move forward, segments further right stay unsorted
+ *
+ * Emitting the first k elements costs O(n + k log k) on average, and iterating
+ * to the end leaves the whole array sorted in-place.
+ */
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "insertion_sort.cpp"
+#include "quick_sort.cpp"
+
+/*
+ * @namespace algorithms
+ * @brief Parent namespace for all namespaces of various algorithms
+ */
+namespace algorithms {
+
+/*
+ * @namespace sort
+ * @brief Functions for sorting algorithms
+ */
+namespace sort {
+
+/*
+ * @brief Sorts a vector in-place on demand, one element at a time
+ */
+template <typename T>
+class IncrementalQuickSort {
+    private:
+        /*
+         * @brief Segments smaller than this are finished with Insertion Sort
+         */
+        static constexpr std::size_t SMALL_SEGMENT = 16;
+
+        struct Segment {
+            std::size_t end;
+            bool sorted;
+        };
+
+        std::vector<T>& array;
+        std::vector<Segment> segments;
+        std::size_t position;
+
+        /*
+         * @brief Partitions [@param begin, @param end) into lesser, equal and greater parts
+         *        around the median of three, returning where the equal part starts and ends
+         */
+        std::pair<std::size_t, std::size_t> _partition(std::size_t begin, std::size_t end) {
+            auto first = array.begin() + begin, last = array.begin() + end;
+
+            std::swap(*first, *medianOfThree(first, first + (end - begin) / 2, last - 1));
+            auto [lesser, greater] = threeWayPartition(first, last);
+
+            return {lesser - array.begin(), greater - array.begin()};
+        }
+
+        /*
+         * @brief Partitions the front segment until the element at the current position is final
+         */
+        void _settleFront() {
+            while (true) {
+                Segment& front = segments.back();
+
+                if (front.end == position) {
+                    segments.pop_back();
+                    continue;
+                }
+
+                if (front.sorted) return;
+
+                if (front.end - position <= SMALL_SEGMENT) {
+                    insertionSort(array.begin() + position, array.begin() + front.end);
+                    front.sorted = true;
+                    return;
+                }
+
+                std::size_t end = front.end;
+                auto [lesser, greater] = _partition(position, end);
+
+                if (greater == end) segments.pop_back();
+
+                segments.push_back({greater, true});
+                if (lesser != position) segments.push_back({lesser, false});
+            }
+        }
+
+    public:
+        /*
+         * @brief Starts lazily sorting @param array in-place. The vector must outlive
+         *        the sorter and must not be modified while it is in use.
+         */
+        IncrementalQuickSort(std::vector<T>& array) : array(array), position(0) {
+            if (!array.empty()) segments.push_back({array.size(), false});
+        }
+
+        /*
+         * @brief Returns if there are elements left to emit
+         */
+        bool hasNext() const {
+            return position < array.size();
+        }
+
+        /*
+         * @brief Returns the next smallest element
+         *
+         * @throws std::out_of_range if every element has been emitted
+         */
+        const T& next() {
+            if (!hasNext()) throw std::out_of_range("All elements have already been emitted.");
+
+            _settleFront();
+            return array[position++];
+        }
+
+        /*
+         * @brief Emits up to @param count elements and returns how many of them were emitted.
+         *        They are left sorted in the array just before the current position.
+         */
+        std::size_t advance(std::size_t count) {
+            std::size_t emitted = 0;
+
+            for (; emitted < count && hasNext(); ++emitted) next();
+
+            return emitted;
+        }
+
+        /*
+         * @brief Returns the number of elements emitted so far, i.e. the length of
+         *        the sorted prefix of the array
+         */
+        std::size_t emitted() const {
+            return position;
+        }
+
+        /*
+         * @brief Input iterator emitting the remaining elements in sorted order
+         */
+        class Iterator {
+            private:
+                IncrementalQuickSort *sorter;
+                const T *current;
+
+            public:
+                using iterator_category = std::input_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const T*;
+                using reference = const T&;
+
+                Iterator() : sorter(nullptr), current(nullptr) {}
+
+                Iterator(IncrementalQuickSort *sorter) : sorter(sorter), current(nullptr) {
+                    ++(*this);
+                }
+
+                reference operator*() const { return *current; }
+                pointer operator->() const { return current; }
+
+                Iterator& operator++() {
+                    if (sorter->hasNext()) current = &sorter->next();
+                    else sorter = nullptr;
+
+                    return *this;
+                }
+
+                void operator++(int) { ++(*this); }
+
+                bool operator==(const Iterator& other) const { return sorter == other.sorter; }
+                bool operator!=(const Iterator& other) const { return sorter != other.sorter; }
+        };
+
+        Iterator begin() { return Iterator(this); }
+        Iterator end() { return Iterator(); }
+};
+
+/*
+ * @brief Sorts only the @param count smallest elements of @param array into its
+ *        front, leaving the rest in unspecified order, in O(n + count log count)
+ *
+ * @param array Array to be partially sorted
+ * @param count Number of elements to be sorted
+ */
+template <typename T>
+void partialQuickSort(std::vector<T>& array, std::size_t count) {
+    IncrementalQuickSort<T> sorter(array);
+    sorter.advance(count);
+}
+
+} // namespace sort
+
+} // namespace algorithms
@@ -8,7 +8,12 @@
  * 2. Repeat for every element
  */
 
+#ifndef ALGORITHMS_SORTING_INSERTION_SORT
+#define ALGORITHMS_SORTING_INSERTION_SORT
+
+#include <array>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 /*
@@ -66,7 +71,54 @@ void insertionSort(std::vector<T>& array) {
     }
 }
 
+/* 
+ * @brief Applies Insertion Sort in-place on the range [@param first, @param last).
+ *        Usable in constant expressions.
+ * 
+ * @param first Iterator to the beginning of the range
+ * @param last Iterator past the end of the range
+ */
+template <typename Iterator>
+constexpr void insertionSort(Iterator first, Iterator last) {
+    if (first == last) return;
+
+    for (auto it = first + 1; it != last; ++it) {
+        auto key = std::move(*it);
+        auto jt = it;
+
+        while (jt != first && key < *(jt - 1)) {
+            *(jt) = std::move(*(jt - 1));
+            --jt;
+        }
+        *(jt) = std::move(key);
+    }
+}
+
+/* 
+ * @brief Applies Insertion Sort in-place on @param array.
+ *        Usable in constant expressions.
+ * 
+ * @param array Array to be sorted
+ */
+template <typename T, std::size_t N>
+constexpr void insertionSort(std::array<T, N>& array) {
+    insertionSort(array.begin(), array.end());
+}
+
+/* 
+ * @brief Returns a sorted copy of @param array, so sorted tables can be
+ *        initialised directly in constant expressions.
+ * 
+ * @param array Array to be sorted
+ */
+template <typename T, std::size_t N>
+constexpr std::array<T, N> insertionSorted(std::array<T, N> array) {
+    insertionSort(array);
+    return array;
+}
+
 } // namespace sort
 
 } // namespace algorithms
 
+#endif // ALGORITHMS_SORTING_INSERTION_SORT
@@ -10,8 +10,14 @@
  * 4. Merge the sorted arrays together
  */
 
+#include <array>
+#include <cstddef>
+#include <utility>
 #include <vector>
 
+#include "in_place_merge_sort.cpp"
+#include "sort_workspace.cpp"
+
 /*
  * @namespace algorithms
  * @brief Parent namespace for all namespaces of various algorithms
@@ -57,6 +63,78 @@ void mergeSort(std::vector<T>& arr) {
     while (j < right.size()) arr.push_back(right[j++]);
 }
 
+/* 
+ * @brief Applies Merge Sort in-place on the range [@param first, @param last),
+ *        using @param buffer as scratch space. Usable in constant expressions.
+ * 
+ * @param first Iterator to the beginning of the range
+ * @param last Iterator past the end of the range
+ * @param buffer Iterator to scratch space holding at least (last - first) / 2 elements
+ */
+template <typename Iterator, typename BufferIterator>
+constexpr void mergeSort(Iterator first, Iterator last, BufferIterator buffer) {
+    std::size_t size = last - first;
+    if (size <= 1) return;
+
+    std::size_t split = size / 2;
+    Iterator middle = first + split;
+
+    mergeSort(first, middle, buffer);
+    mergeSort(middle, last, buffer);
+
+    for (std::size_t k = 0; k < split; ++k) buffer[k] = std::move(first[k]);
+
+    std::size_t i = 0, j = 0, k = 0;
+    while (i < split && j < size - split) {
+        if (middle[j] < buffer[i]) {
+            first[k++] = std::move(middle[j++]);
+        } else {
+            first[k++] = std::move(buffer[i++]);
+        }
+    }
+
+    while (i < split) first[k++] = std::move(buffer[i++]);
+}
+
+/* 
+ * @brief Applies Merge Sort in-place on @param array.
+ *        Usable in constant expressions.
+ * 
+ * @param array Array to be sorted
+ */
+template <typename T, std::size_t N>
+constexpr void mergeSort(std::array<T, N>& array) {
+    std::array<T, N / 2 + 1> buffer{};
+    mergeSort(array.begin(), array.end(), buffer.begin());
+}
+
+/* 
+ * @brief Returns a sorted copy of @param array, so sorted tables can be
+ *        initialised directly in constant expressions.
+ * 
+ * @param array Array to be sorted
+ */
+template <typename T, std::size_t N>
+constexpr std::array<T, N> mergeSorted(std::array<T, N> array) {
+    mergeSort(array);
+    return array;
+}
+
+/* 
+ * @brief Applies stable Merge Sort in-place on @param array, taking its scratch space
+ *        from @param workspace instead of allocating. If the workspace holds fewer
+ *        than half as many elements as @param array, the merges that do not fit
+ *        are done in-place with rotations.
+ * 
+ * @param array Array to be sorted
+ * @param workspace Scratch memory to be used
+ */
+template <typename T>
+void mergeSort(std::vector<T>& array, SortWorkspace& workspace) {
+    ScratchBuffer<T> buffer = workspace.acquire<T>(array.size() / 2 + 1);
+    inPlaceMergeSort(array.begin(), array.end(), buffer.data(), buffer.size());
+}
+
 } // namespace sort
 
 } // namespace algorithms
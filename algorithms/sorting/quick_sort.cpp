@@ -7,11 +7,29 @@
  * 1. Pick a pivot element
  * 2. Partition arrays so elements lesser than pivot are on the left, and elements greater than pivot are on the right
  * 3. Recursively sort the left and right arrays
+ *
+ * For std::int32_t, std::int64_t and float the partitioning and the small leaves
+ * are vectorised with AVX2 or AVX-512, whichever the CPU supports (see simd).
 */
 
+#ifndef ALGORITHMS_SORTING_QUICK_SORT
+#define ALGORITHMS_SORTING_QUICK_SORT
+
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#endif
+
+#include "sort_workspace.cpp"
+
 /*
  * @namespace algorithms
  * @brief Parent namespace for all namespaces of various algorithms
@@ -31,10 +49,10 @@ namespace sort {
  */
 template <typename T>
 void quickSort(std::vector<T>& array) {
-    if (array.size() == 1) return;
+    if (array.size() <= 1) return;
 
     T pivot = array.back();
-    std::size_t pivotCount = 1;
+    std::size_t pivotCount = 0;
 
     std::vector<T> left, right;
 
@@ -55,7 +73,665 @@ void quickSort(std::vector<T>& array) {
     array.insert(array.end(), right.begin(), right.end());
 }
 
+/*
+ * @brief Returns whichever of the iterators @param a, @param b and @param c
+ *        points to the median of the three elements
+ */
+template <typename Iterator>
+constexpr Iterator medianOfThree(Iterator a, Iterator b, Iterator c) {
+    if (*a < *b) return *b < *c ? b : (*a < *c ? c : a);
+    return *a < *c ? a : (*b < *c ? c : b);
+}
+
+/*
+ * @brief Partitions [@param first, @param last) into lesser, equal and greater parts
+ *        around the element at @param first, returning where the equal part starts
+ *        and ends. The pivot is kept at the front while partitioning instead of
+ *        being copied, and moved into the equal part at the end.
+ */
+template <typename Iterator>
+constexpr std::pair<Iterator, Iterator> threeWayPartition(Iterator first, Iterator last) {
+    Iterator lesser = first + 1, current = first + 1, greater = last;
+
+    while (current != greater) {
+        if (*current < *first) std::swap(*(lesser++), *(current++));
+        else if (*first < *current) std::swap(*current, *(--greater));
+        else ++current;
+    }
+
+    std::swap(*first, *(--lesser));
+
+    return {lesser, greater};
+}
+
+/* 
+ * @brief Applies Quick Sort in-place on the range [@param first, @param last).
+ *        Usable in constant expressions.
+ *
+ * Uses a three-way partition around the median of the first, middle and last
+ * elements, so runs of equal elements are settled in one pass like the pivot
+ * count above. Recurses into the smaller part and loops on the larger one to
+ * keep the depth logarithmic.
+ * 
+ * @param first Iterator to the beginning of the range
+ * @param last Iterator past the end of the range
+ */
+template <typename Iterator>
+constexpr void quickSort(Iterator first, Iterator last) {
+    while (last - first > 1) {
+        std::swap(*first, *medianOfThree(first, first + (last - first) / 2, last - 1));
+
+        auto [lesser, greater] = threeWayPartition(first, last);
+
+        if (lesser - first < last - greater) {
+            quickSort(first, lesser);
+            first = greater;
+        } else {
+            quickSort(greater, last);
+            last = lesser;
+        }
+    }
+}
+
+/* 
+ * @brief Applies Quick Sort in-place on @param array.
+ *        Usable in constant expressions.
+ * 
+ * @param array Array to be sorted
+ */
+template <typename T, std::size_t N>
+constexpr void quickSort(std::array<T, N>& array) {
+    quickSort(array.begin(), array.end());
+}
+
+/* 
+ * @brief Returns a sorted copy of @param array, so sorted tables can be
+ *        initialised directly in constant expressions.
+ * 
+ * @param array Array to be sorted
+ */
+template <typename T, std::size_t N>
+constexpr std::array<T, N> quickSorted(std::array<T, N> array) {
+    quickSort(array);
+    return array;
+}
+
+/*
+ * @namespace simd
+ * @brief Vectorised Quick Sort for primitive types, chosen at runtime by CPU support
+ *
+ * Partitioning compares a whole register against the pivot and packs the lesser
+ * and greater lanes apart, with a permutation table on AVX2 and compress-stores on
+ * AVX-512. Small ranges are sorted inside registers with a bitonic sorting network.
+ * NaNs are not supported when sorting floats.
+ */
+namespace simd {
+
+/*
+ * @brief Instruction set levels the vectorised sort can run at
+ */
+enum class Level { Scalar, AVX2, AVX512 };
+
+/*
+ * @brief Partitions @param array of @param size elements so the lesser ones come first,
+ *        returning where the greater ones start. Elements equal to @param pivot go
+ *        to the left if @param orEqual is set, otherwise to the right.
+ */
+template <typename T>
+std::size_t scalarPartition(T *array, std::size_t size, T pivot, bool orEqual) {
+    std::size_t left = 0;
+
+    for (std::size_t i = 0; i < size; ++i) {
+        if (array[i] < pivot || (orEqual && !(pivot < array[i]))) std::swap(array[left++], array[i]);
+    }
+
+    return left;
+}
+
+/*
+ * @brief Moves the elements held back by a vectorised partition into the gap
+ *        [@param left, @param right) left between the two written parts
+ */
+template <typename T>
+std::size_t finishPartition(T *array, std::size_t left, std::size_t right,
+                            const T *held, std::size_t count, T pivot, bool orEqual) {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (held[i] < pivot || (orEqual && !(pivot < held[i]))) array[left++] = held[i];
+        else array[--right] = held[i];
+    }
+
+    return left;
+}
+
+/*
+ * @brief Largest value of @param T, used to pad partially filled registers
+ */
+template <typename T>
+constexpr T paddingValue() {
+    return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+}
+
+/*
+ * @brief Vectorised routines for one element type at one instruction set level
+ */
+template <typename T>
+struct Kernels {
+    std::size_t (*partition)(T *, std::size_t, T, bool);
+    void (*leafSort)(T *, std::size_t);
+    std::size_t leafSize;
+};
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+
+#define QUICK_SORT_AVX2 __attribute__((target("avx2")))
+#define QUICK_SORT_AVX512 __attribute__((target("avx512f")))
+
+/*
+ * @brief For every bit mask of lanes going right, the lane order that packs the
+ *        lanes going left first and the lanes going right last, keeping their order.
+ *        Entries are 32-bit lane indices, 64-bit lanes use two of them.
+ */
+template <std::size_t LANES>
+struct CompactTable {
+    std::int32_t index[1 << LANES][8];
+
+    constexpr CompactTable() : index{} {
+        constexpr std::size_t WIDTH = 8 / LANES;
+
+        for (std::size_t mask = 0; mask < (1 << LANES); ++mask) {
+            std::size_t position = 0;
+
+            for (int right = 0; right < 2; ++right) {
+                for (std::size_t lane = 0; lane < LANES; ++lane) {
+                    if (((mask >> lane) & 1) != static_cast<std::size_t>(right)) continue;
+
+                    for (std::size_t part = 0; part < WIDTH; ++part) {
+                        index[mask][position++] = lane * WIDTH + part;
+                    }
+                }
+            }
+        }
+    }
+};
+
+inline constexpr CompactTable<8> COMPACT_8{};
+inline constexpr CompactTable<4> COMPACT_4{};
+
+/*
+ * @namespace avx2
+ * @brief Kernels using 256-bit AVX2 registers
+ */
+namespace avx2 {
+
+struct Int32 {
+    using Type = std::int32_t;
+    using Register = __m256i;
+    static constexpr std::size_t LANES = 8;
+
+    QUICK_SORT_AVX2 static Register load(const Type *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+    QUICK_SORT_AVX2 static void store(Type *p, Register v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+    QUICK_SORT_AVX2 static Register set(Type x) { return _mm256_set1_epi32(x); }
+    QUICK_SORT_AVX2 static Register min(Register a, Register b) { return _mm256_min_epi32(a, b); }
+    QUICK_SORT_AVX2 static Register max(Register a, Register b) { return _mm256_max_epi32(a, b); }
+
+    QUICK_SORT_AVX2 static unsigned rightMask(Register v, Register pivot, bool orEqual) {
+        if (orEqual) return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, pivot)));
+        return ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pivot, v))) & 0xFF;
+    }
+
+    QUICK_SORT_AVX2 static Register compact(Register v, unsigned mask) {
+        return _mm256_permutevar8x32_epi32(v, load(COMPACT_8.index[mask]));
+    }
+
+    QUICK_SORT_AVX2 static Register permuteXor(Register v, int j) {
+        return _mm256_permutevar8x32_epi32(v, _mm256_xor_si256(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(j)));
+    }
+
+    QUICK_SORT_AVX2 static Register blend(Register a, Register b, unsigned bits) {
+        __m256i lanes = _mm256_and_si256(_mm256_set1_epi32(bits), _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128));
+        return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi32(lanes, _mm256_setzero_si256()));
+    }
+};
+
+struct Float {
+    using Type = float;
+    using Register = __m256;
+    static constexpr std::size_t LANES = 8;
+
+    QUICK_SORT_AVX2 static Register load(const Type *p) { return _mm256_loadu_ps(p); }
+    QUICK_SORT_AVX2 static void store(Type *p, Register v) { _mm256_storeu_ps(p, v); }
+    QUICK_SORT_AVX2 static Register set(Type x) { return _mm256_set1_ps(x); }
+    QUICK_SORT_AVX2 static Register min(Register a, Register b) { return _mm256_min_ps(a, b); }
+    QUICK_SORT_AVX2 static Register max(Register a, Register b) { return _mm256_max_ps(a, b); }
+
+    QUICK_SORT_AVX2 static unsigned rightMask(Register v, Register pivot, bool orEqual) {
+        if (orEqual) return _mm256_movemask_ps(_mm256_cmp_ps(v, pivot, _CMP_GT_OQ));
+        return _mm256_movemask_ps(_mm256_cmp_ps(v, pivot, _CMP_GE_OQ));
+    }
+
+    QUICK_SORT_AVX2 static Register compact(Register v, unsigned mask) {
+        return _mm256_permutevar8x32_ps(v, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(COMPACT_8.index[mask])));
+    }
+
+    QUICK_SORT_AVX2 static Register permuteXor(Register v, int j) {
+        return _mm256_permutevar8x32_ps(v, _mm256_xor_si256(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(j)));
+    }
+
+    QUICK_SORT_AVX2 static Register blend(Register a, Register b, unsigned bits) {
+        __m256i lanes = _mm256_and_si256(_mm256_set1_epi32(bits), _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128));
+        return _mm256_blendv_ps(a, b, _mm256_castsi256_ps(_mm256_cmpgt_epi32(lanes, _mm256_setzero_si256())));
+    }
+};
+
+struct Int64 {
+    using Type = std::int64_t;
+    using Register = __m256i;
+    static constexpr std::size_t LANES = 4;
+
+    QUICK_SORT_AVX2 static Register load(const Type *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+    QUICK_SORT_AVX2 static void store(Type *p, Register v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+    QUICK_SORT_AVX2 static Register set(Type x) { return _mm256_set1_epi64x(x); }
+    QUICK_SORT_AVX2 static Register min(Register a, Register b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+    QUICK_SORT_AVX2 static Register max(Register a, Register b) { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+
+    QUICK_SORT_AVX2 static unsigned rightMask(Register v, Register pivot, bool orEqual) {
+        if (orEqual) return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(v, pivot)));
+        return ~_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(pivot, v))) & 0xF;
+    }
+
+    QUICK_SORT_AVX2 static Register compact(Register v, unsigned mask) {
+        return _mm256_permutevar8x32_epi32(v, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(COMPACT_4.index[mask])));
+    }
+
+    QUICK_SORT_AVX2 static Register permuteXor(Register v, int j) {
+        return _mm256_permutevar8x32_epi32(v, _mm256_xor_si256(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(2 * j)));
+    }
+
+    QUICK_SORT_AVX2 static Register blend(Register a, Register b, unsigned bits) {
+        __m256i lanes = _mm256_and_si256(_mm256_set1_epi64x(bits), _mm256_setr_epi64x(1, 2, 4, 8));
+        return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(lanes, _mm256_setzero_si256()));
+    }
+};
+
+/*
+ * @brief One compare-exchange step of a bitonic network inside register @param v,
+ *        between lanes @param j apart, sorting blocks of @param k lanes in alternating order
+ */
+template <typename V>
+QUICK_SORT_AVX2 typename V::Register bitonicStep(typename V::Register v, std::size_t k, std::size_t j) {
+    unsigned takeMax = 0;
+
+    for (std::size_t lane = 0; lane < V::LANES; ++lane) {
+        if (((lane & j) != 0) == ((lane & k) == 0)) takeMax |= 1u << lane;
+    }
+
+    typename V::Register partner = V::permuteXor(v, j);
+    return V::blend(V::min(v, partner), V::max(v, partner), takeMax);
+}
+
+/*
+ * @brief Sorts the lanes of register @param v with a bitonic sorting network
+ */
+template <typename V>
+QUICK_SORT_AVX2 typename V::Register sortRegister(typename V::Register v) {
+    for (std::size_t k = 2; k <= V::LANES; k *= 2) {
+        for (std::size_t j = k / 2; j > 0; j /= 2) v = bitonicStep<V>(v, k, j);
+    }
+
+    return v;
+}
+
+/*
+ * @brief Sorts the lanes of register @param v holding a bitonic sequence
+ */
+template <typename V>
+QUICK_SORT_AVX2 typename V::Register mergeRegister(typename V::Register v) {
+    for (std::size_t j = V::LANES / 2; j > 0; j /= 2) v = bitonicStep<V>(v, 2 * V::LANES, j);
+
+    return v;
+}
+
+/*
+ * @brief Sorts up to two registers worth of elements inside registers
+ */
+template <typename V>
+QUICK_SORT_AVX2 void leafSort(typename V::Type *array, std::size_t size) {
+    using Type = typename V::Type;
+
+    Type buffer[2 * V::LANES];
+    for (std::size_t i = 0; i < 2 * V::LANES; ++i) buffer[i] = i < size ? array[i] : paddingValue<Type>();
+
+    typename V::Register low = sortRegister<V>(V::load(buffer));
+
+    if (size > V::LANES) {
+        typename V::Register high = V::permuteXor(sortRegister<V>(V::load(buffer + V::LANES)), V::LANES - 1);
+
+        V::store(buffer + V::LANES, mergeRegister<V>(V::max(low, high)));
+        low = mergeRegister<V>(V::min(low, high));
+    }
+
+    V::store(buffer, low);
+    for (std::size_t i = 0; i < size; ++i) array[i] = buffer[i];
+}
+
+/*
+ * @brief Vectorised partition, see scalarPartition
+ *
+ * The first few elements and one register from each end are held back, so there
+ * is always at least one register of free space on the side being written.
+ */
+template <typename V>
+QUICK_SORT_AVX2 std::size_t partition(typename V::Type *array, std::size_t size, typename V::Type pivot, bool orEqual) {
+    using Type = typename V::Type;
+    constexpr std::size_t LANES = V::LANES;
+
+    if (size < 2 * LANES) return scalarPartition(array, size, pivot, orEqual);
+
+    Type held[3 * LANES];
+    std::size_t remainder = size % LANES;
+
+    for (std::size_t i = 0; i < remainder; ++i) held[i] = array[i];
+    V::store(held + remainder, V::load(array + remainder));
+    V::store(held + remainder + LANES, V::load(array + size - LANES));
+
+    typename V::Register pivots = V::set(pivot);
+    std::size_t leftStore = 0, rightStore = size;
+    std::size_t left = remainder + LANES, right = size - LANES;
+
+    while (left != right) {
+        typename V::Register v;
+
+        if (rightStore - right < left - leftStore) {
+            right -= LANES;
+            v = V::load(array + right);
+        } else {
+            v = V::load(array + left);
+            left += LANES;
+        }
+
+        unsigned mask = V::rightMask(v, pivots, orEqual);
+        std::size_t greater = __builtin_popcount(mask);
+
+        typename V::Register packed = V::compact(v, mask);
+        V::store(array + leftStore, packed);
+        V::store(array + rightStore - LANES, packed);
+
+        leftStore += LANES - greater;
+        rightStore -= greater;
+    }
+
+    return finishPartition(array, leftStore, rightStore, held, remainder + 2 * LANES, pivot, orEqual);
+}
+
+} // namespace avx2
+
+/*
+ * @namespace avx512
+ * @brief Kernels using 512-bit AVX-512 registers and compress-stores
+ */
+namespace avx512 {
+
+struct Int32 {
+    using Type = std::int32_t;
+    using Register = __m512i;
+    using Leaf = avx2::Int32;
+    static constexpr std::size_t LANES = 16;
+
+    QUICK_SORT_AVX512 static Register load(const Type *p) { return _mm512_loadu_si512(p); }
+    QUICK_SORT_AVX512 static void store(Type *p, Register v) { _mm512_storeu_si512(p, v); }
+    QUICK_SORT_AVX512 static Register set(Type x) { return _mm512_set1_epi32(x); }
+
+    QUICK_SORT_AVX512 static unsigned rightMask(Register v, Register pivot, bool orEqual) {
+        return orEqual ? _mm512_cmpgt_epi32_mask(v, pivot) : _mm512_cmpge_epi32_mask(v, pivot);
+    }
+
+    QUICK_SORT_AVX512 static void compressStore(Type *p, unsigned mask, Register v) { _mm512_mask_compressstoreu_epi32(p, mask, v); }
+};
+
+struct Float {
+    using Type = float;
+    using Register = __m512;
+    using Leaf = avx2::Float;
+    static constexpr std::size_t LANES = 16;
+
+    QUICK_SORT_AVX512 static Register load(const Type *p) { return _mm512_loadu_ps(p); }
+    QUICK_SORT_AVX512 static void store(Type *p, Register v) { _mm512_storeu_ps(p, v); }
+    QUICK_SORT_AVX512 static Register set(Type x) { return _mm512_set1_ps(x); }
+
+    QUICK_SORT_AVX512 static unsigned rightMask(Register v, Register pivot, bool orEqual) {
+        return orEqual ? _mm512_cmp_ps_mask(v, pivot, _CMP_GT_OQ) : _mm512_cmp_ps_mask(v, pivot, _CMP_GE_OQ);
+    }
+
+    QUICK_SORT_AVX512 static void compressStore(Type *p, unsigned mask, Register v) { _mm512_mask_compressstoreu_ps(p, mask, v); }
+};
+
+struct Int64 {
+    using Type = std::int64_t;
+    using Register = __m512i;
+    using Leaf = avx2::Int64;
+    static constexpr std::size_t LANES = 8;
+
+    QUICK_SORT_AVX512 static Register load(const Type *p) { return _mm512_loadu_si512(p); }
+    QUICK_SORT_AVX512 static void store(Type *p, Register v) { _mm512_storeu_si512(p, v); }
+    QUICK_SORT_AVX512 static Register set(Type x) { return _mm512_set1_epi64(x); }
+
+    QUICK_SORT_AVX512 static unsigned rightMask(Register v, Register pivot, bool orEqual) {
+        return orEqual ? _mm512_cmpgt_epi64_mask(v, pivot) : _mm512_cmpge_epi64_mask(v, pivot);
+    }
+
+    QUICK_SORT_AVX512 static void compressStore(Type *p, unsigned mask, Register v) { _mm512_mask_compressstoreu_epi64(p, mask, v); }
+};
+
+/*
+ * @brief Vectorised partition, see avx2::partition. Compress-stores write only the
+ *        lanes that belong on each side, so no permutation table is needed.
+ */
+template <typename V>
+QUICK_SORT_AVX512 std::size_t partition(typename V::Type *array, std::size_t size, typename V::Type pivot, bool orEqual) {
+    using Type = typename V::Type;
+    constexpr std::size_t LANES = V::LANES;
+
+    if (size < 2 * LANES) return scalarPartition(array, size, pivot, orEqual);
+
+    Type held[3 * LANES];
+    std::size_t remainder = size % LANES;
+
+    for (std::size_t i = 0; i < remainder; ++i) held[i] = array[i];
+    V::store(held + remainder, V::load(array + remainder));
+    V::store(held + remainder + LANES, V::load(array + size - LANES));
+
+    typename V::Register pivots = V::set(pivot);
+    std::size_t leftStore = 0, rightStore = size;
+    std::size_t left = remainder + LANES, right = size - LANES;
+
+    while (left != right) {
+        typename V::Register v;
+
+        if (rightStore - right < left - leftStore) {
+            right -= LANES;
+            v = V::load(array + right);
+        } else {
+            v = V::load(array + left);
+            left += LANES;
+        }
+
+        unsigned mask = V::rightMask(v, pivots, orEqual);
+        std::size_t greater = __builtin_popcount(mask);
+
+        V::compressStore(array + leftStore, ~mask & ((1u << LANES) - 1), v);
+        V::compressStore(array + rightStore - greater, mask, v);
+
+        leftStore += LANES - greater;
+        rightStore -= greater;
+    }
+
+    return finishPartition(array, leftStore, rightStore, held, remainder + 2 * LANES, pivot, orEqual);
+}
+
+} // namespace avx512
+
+#undef QUICK_SORT_AVX2
+#undef QUICK_SORT_AVX512
+
+/*
+ * @brief Returns the highest level supported by the running CPU
+ */
+inline Level detectLevel() {
+    static const Level level = []() {
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2")) return Level::AVX512;
+        if (__builtin_cpu_supports("avx2")) return Level::AVX2;
+        return Level::Scalar;
+    }();
+
+    return level;
+}
+
+/*
+ * @brief Returns the kernels for @param level, or nullptr to use the scalar sort
+ */
+template <typename V512>
+const Kernels<typename V512::Type> *kernelsFor(Level level) {
+    using Type = typename V512::Type;
+    using V256 = typename V512::Leaf;
+
+    static const Kernels<Type> AVX512_KERNELS{avx512::partition<V512>, avx2::leafSort<V256>, 2 * V256::LANES};
+    static const Kernels<Type> AVX2_KERNELS{avx2::partition<V256>, avx2::leafSort<V256>, 2 * V256::LANES};
+
+    if (level > detectLevel()) level = detectLevel();
+
+    if (level == Level::AVX512) return &AVX512_KERNELS;
+    if (level == Level::AVX2) return &AVX2_KERNELS;
+    return nullptr;
+}
+
+inline const Kernels<std::int32_t> *kernels(std::int32_t *, Level level) { return kernelsFor<avx512::Int32>(level); }
+inline const Kernels<std::int64_t> *kernels(std::int64_t *, Level level) { return kernelsFor<avx512::Int64>(level); }
+inline const Kernels<float> *kernels(float *, Level level) { return kernelsFor<avx512::Float>(level); }
+
+#else
+
+inline Level detectLevel() {
+    return Level::Scalar;
+}
+
+template <typename T>
+const Kernels<T> *kernels(T *, Level) {
+    return nullptr;
+}
+
+#endif
+
+/*
+ * @brief Quick Sort of @param array using the partition and leaf kernels of
+ *        @param kernels, switching to Heap Sort once @param depth runs out
+ */
+template <typename T>
+void sort(T *array, std::size_t size, const Kernels<T>& kernels, std::size_t depth) {
+    while (size > kernels.leafSize) {
+        if (depth-- == 0) {
+            std::make_heap(array, array + size);
+            std::sort_heap(array, array + size);
+            return;
+        }
+
+        std::size_t step = size / 8;
+        T pivot = *medianOfThree(medianOfThree(array, array + step, array + 2 * step),
+                                 medianOfThree(array + 3 * step, array + 4 * step, array + 5 * step),
+                                 medianOfThree(array + 6 * step, array + 7 * step, array + size - 1));
+
+        std::size_t middle = kernels.partition(array, size, pivot, false);
+
+        if (middle == 0) {
+            middle = kernels.partition(array, size, pivot, true);
+            array += middle;
+            size -= middle;
+            continue;
+        }
+
+        if (middle < size - middle) {
+            sort(array, middle, kernels, depth);
+            array += middle;
+            size -= middle;
+        } else {
+            sort(array + middle, size - middle, kernels, depth);
+            size = middle;
+        }
+    }
+
+    kernels.leafSort(array, size);
+}
+
+/*
+ * @brief Sorts @param array of @param size elements with the vectorised Quick Sort,
+ *        using at most the instruction set @param level (and only what the CPU supports)
+ */
+template <typename T>
+void sort(T *array, std::size_t size, Level level = Level::AVX512) {
+    const Kernels<T> *chosen = kernels(array, level);
+
+    if (!chosen) {
+        quickSort(array, array + size);
+        return;
+    }
+
+    std::size_t depth = 0;
+    for (std::size_t n = size; n > 1; n /= 2) depth += 2;
+
+    sort(array, size, *chosen, depth);
+}
+
+} // namespace simd
+
+/* 
+ * @brief Applies vectorised Quick Sort in-place on @param array
+ * 
+ * @param array Array to be sorted
+ */
+inline void quickSort(std::vector<std::int32_t>& array) {
+    simd::sort(array.data(), array.size());
+}
+
+/* 
+ * @brief Applies vectorised Quick Sort in-place on @param array
+ * 
+ * @param array Array to be sorted
+ */
+inline void quickSort(std::vector<std::int64_t>& array) {
+    simd::sort(array.data(), array.size());
+}
+
+/* 
+ * @brief Applies vectorised Quick Sort in-place on @param array.
+ *        The array must not contain NaNs.
+ * 
+ * @param array Array to be sorted
+ */
+inline void quickSort(std::vector<float>& array) {
+    simd::sort(array.data(), array.size());
+}
+
+/* 
+ * @brief Applies Quick Sort in-place on @param array without allocating.
+ *        Partitioning is done in-place, so no scratch space is taken from
+ *        @param workspace; it is accepted so every sort can be called the same way.
+ * 
+ * @param array Array to be sorted
+ * @param workspace Scratch memory to be used
+ */
+template <typename T>
+void quickSort(std::vector<T>& array, SortWorkspace&) {
+    if constexpr (std::is_same_v<T, std::int32_t> || std::is_same_v<T, std::int64_t> || std::is_same_v<T, float>) {
+        simd::sort(array.data(), array.size());
+    } else {
+        quickSort(array.begin(), array.end());
+    }
+}
+
 } // namespace sort
 
 } // namespace algorithms
 
+#endif // ALGORITHMS_SORTING_QUICK_SORT
+
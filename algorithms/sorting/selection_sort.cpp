@@ -39,7 +39,7 @@ void selectionSort(int *array, std::size_t size) {
     for (std::size_t i = 0; i < size; ++i) {
         min = i;
 
-        for (std::size_t j = i + 1; i < size; ++j) {
+        for (std::size_t j = i + 1; j < size; ++j) {
             if (array[j] < array[min]) min = j;
         }
 
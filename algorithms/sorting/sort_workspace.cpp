@@ -0,0 +1,206 @@
+/*
+ * @file
+ *
+ * @brief Implements a reusable scratch memory workspace for the sorting algorithms
+ *
+ * A workspace reserves its memory once, up to a fixed budget, and lends it to every
+ * sort it is passed to. Sorts that need more scratch space than the budget allows fall
+ * back to slower in-place work instead of allocating, so sorting with a workspace
+ * performs no heap allocations. Several buffers can be borrowed at once, they are
+ * handed out one after the other and have to be returned in reverse order. On Linux
+ * the memory can be backed by huge pages.
+ */
+
+#ifndef ALGORITHMS_SORTING_SORT_WORKSPACE
+#define ALGORITHMS_SORTING_SORT_WORKSPACE
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+/*
+ * @namespace algorithms
+ * @brief Parent namespace for all namespaces of various algorithms
+ */
+namespace algorithms {
+
+/*
+ * @namespace sort
+ * @brief Functions for sorting algorithms
+ */
+namespace sort {
+
+class SortWorkspace;
+
+/*
+ * @brief Scratch elements borrowed from a SortWorkspace, returned when it goes out of scope
+ */
+template <typename T>
+class ScratchBuffer {
+    private:
+        SortWorkspace *workspace;
+        T *elements;
+        std::size_t count;
+        std::size_t previousUsed;
+
+        friend class SortWorkspace;
+
+        ScratchBuffer(SortWorkspace *workspace, T *elements, std::size_t count, std::size_t previousUsed)
+            : workspace(workspace), elements(elements), count(count), previousUsed(previousUsed) {
+            std::uninitialized_default_construct_n(elements, count);
+        }
+
+    public:
+        ScratchBuffer(const ScratchBuffer&) = delete;
+        ScratchBuffer& operator=(const ScratchBuffer&) = delete;
+
+        /*
+         * @brief First scratch element
+         */
+        T *data() const {
+            return this->elements;
+        }
+
+        /*
+         * @brief Number of scratch elements, possibly fewer than requested
+         */
+        std::size_t size() const {
+            return this->count;
+        }
+
+        ~ScratchBuffer();
+};
+
+class SortWorkspace {
+    private:
+        void *memory;
+        std::size_t capacity;
+        std::size_t used;
+        bool hugePages;
+        bool mapped;
+
+        template <typename T>
+        friend class ScratchBuffer;
+
+        static constexpr std::size_t HUGE_PAGE = 2 * 1024 * 1024;
+        static constexpr std::size_t ALIGNMENT = 64;
+
+    public:
+        /*
+         * @brief Reserves @param maxBytes bytes of scratch memory. If @param useHugePages
+         *        is set, huge pages are requested for the memory where the system allows it.
+         *
+         * @throws std::bad_alloc if the memory cannot be reserved
+         */
+        SortWorkspace(std::size_t maxBytes, bool useHugePages = false)
+            : memory(nullptr), capacity(maxBytes), used(0), hugePages(false), mapped(false) {
+            if (maxBytes == 0) return;
+
+#if defined(__linux__)
+            if (useHugePages) this->capacity = (maxBytes + HUGE_PAGE - 1) / HUGE_PAGE * HUGE_PAGE;
+
+            int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE;
+            void *pointer = MAP_FAILED;
+
+            if (useHugePages) {
+                pointer = mmap(nullptr, this->capacity, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB, -1, 0);
+                this->hugePages = pointer != MAP_FAILED;
+            }
+
+            if (pointer == MAP_FAILED && useHugePages) {
+                // Transparent huge pages only back huge page aligned memory, so map one huge
+                // page more than needed and unmap the unaligned head and tail
+                std::size_t length = this->capacity + HUGE_PAGE;
+                char *raw = static_cast<char *>(mmap(nullptr, length, PROT_READ | PROT_WRITE, flags & ~MAP_POPULATE, -1, 0));
+                if (raw == MAP_FAILED) throw std::bad_alloc();
+
+                char *aligned = raw + (HUGE_PAGE - reinterpret_cast<std::uintptr_t>(raw) % HUGE_PAGE) % HUGE_PAGE;
+                if (aligned != raw) munmap(raw, aligned - raw);
+                if (aligned + this->capacity != raw + length) munmap(aligned + this->capacity, raw + length - (aligned + this->capacity));
+                pointer = aligned;
+
+                // Advise before the first touch, then fault the pages in
+                this->hugePages = madvise(pointer, this->capacity, MADV_HUGEPAGE) == 0;
+
+                for (std::size_t offset = 0; offset < this->capacity; offset += 4096) {
+                    static_cast<volatile char *>(pointer)[offset] = 0;
+                }
+            }
+
+            if (pointer == MAP_FAILED) {
+                pointer = mmap(nullptr, this->capacity, PROT_READ | PROT_WRITE, flags, -1, 0);
+                if (pointer == MAP_FAILED) throw std::bad_alloc();
+            }
+
+            this->memory = pointer;
+            this->mapped = true;
+#else
+            (void) useHugePages;
+            this->memory = ::operator new(this->capacity, std::align_val_t(ALIGNMENT));
+#endif
+        }
+
+        SortWorkspace(const SortWorkspace&) = delete;
+        SortWorkspace& operator=(const SortWorkspace&) = delete;
+
+        /*
+         * @brief Borrows scratch space for up to @param count elements of @param T
+         *        from the memory not borrowed yet, fewer if the budget is too small
+         */
+        template <typename T>
+        ScratchBuffer<T> acquire(std::size_t count) {
+            static_assert(alignof(T) <= ALIGNMENT, "Element alignment is larger than the workspace alignment.");
+
+            std::size_t start = (this->used + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+            std::size_t fits = start < this->capacity ? (this->capacity - start) / sizeof(T) : 0;
+            if (count > fits) count = fits;
+
+            std::size_t previousUsed = this->used;
+            if (count) this->used = start + count * sizeof(T);
+
+            T *elements = count ? reinterpret_cast<T *>(static_cast<char *>(this->memory) + start) : nullptr;
+            return ScratchBuffer<T>(this, elements, count, previousUsed);
+        }
+
+        /*
+         * @brief Size of the scratch memory in bytes
+         */
+        std::size_t size() const {
+            return this->capacity;
+        }
+
+        /*
+         * @brief Returns if huge pages were granted for the scratch memory, or advised
+         *        for it on a huge page aligned mapping (transparent huge pages)
+         */
+        bool usesHugePages() const {
+            return this->hugePages;
+        }
+
+        ~SortWorkspace() {
+            if (!this->memory) return;
+
+#if defined(__linux__)
+            if (this->mapped) munmap(this->memory, this->capacity);
+#else
+            ::operator delete(this->memory, std::align_val_t(ALIGNMENT));
+#endif
+        }
+};
+
+template <typename T>
+ScratchBuffer<T>::~ScratchBuffer() {
+    std::destroy_n(this->elements, this->count);
+    this->workspace->used = this->previousUsed;
+}
+
+} // namespace sort
+
+} // namespace algorithms
+
+#endif // ALGORITHMS_SORTING_SORT_WORKSPACE
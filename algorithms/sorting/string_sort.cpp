@@ -0,0 +1,384 @@
+/*
+ * @file
+ *
+ * @brief Implements sorting algorithms specialised for strings
+ *
+ * Comparison sorts compare whole strings from their first character every time.
+ * These sorts look at one character position at a time instead, so shared prefixes
+ * are only read once:
+ * - Multikey Quick Sort: three-way Quick Sort on the current character, the equal part
+ *   moves on to the next character
+ * - MSD Radix Sort: buckets the strings by their current character, then sorts each bucket
+ *   on the next character
+ * - LCP Merge Sort: Merge Sort that remembers the longest common prefix (LCP) of every string
+ *   with its predecessor, and skips it when comparing
+ *
+ * Strings are only ever swapped or moved, never copied. Each sort can take its scratch
+ * space from a SortWorkspace, and falls back to slower in-place work if it does not fit.
+ */
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "in_place_merge_sort.cpp"
+#include "sort_workspace.cpp"
+
+/*
+ * @namespace algorithms
+ * @brief Parent namespace for all namespaces of various algorithms
+ */
+namespace algorithms {
+
+/*
+ * @namespace sort
+ * @brief Functions for sorting algorithms
+ */
+namespace sort {
+
+/*
+ * @namespace string_sort
+ * @brief Helper routines of the string sorts
+ */
+namespace string_sort {
+
+/*
+ * @brief Ranges smaller than this are finished with Insertion Sort
+ */
+constexpr std::size_t SMALL_RANGE = 16;
+
+/*
+ * @brief Character of @param s at @param depth, shifted up by one so that
+ *        the end of the string (0) sorts before every character
+ */
+inline int charAt(const std::string& s, std::size_t depth) {
+    return depth < s.size() ? static_cast<unsigned char>(s[depth]) + 1 : 0;
+}
+
+/*
+ * @brief Compares @param a and @param b from @param depth on, knowing that
+ *        they are equal before it
+ */
+inline bool lessFrom(const std::string& a, const std::string& b, std::size_t depth) {
+    return a.compare(depth, std::string::npos, b, depth, std::string::npos) < 0;
+}
+
+/*
+ * @brief Insertion Sort of [@param begin, @param end) whose strings share
+ *        their first @param depth characters
+ */
+inline void insertionSort(std::vector<std::string>& array, std::size_t begin, std::size_t end, std::size_t depth) {
+    for (std::size_t i = begin + 1; i < end; ++i) {
+        for (std::size_t j = i; j > begin && lessFrom(array[j], array[j - 1], depth); --j) {
+            std::swap(array[j], array[j - 1]);
+        }
+    }
+}
+
+/*
+ * @brief Multikey Quick Sort of [@param begin, @param end) at @param depth.
+ *        @param cache holds the character at @param depth of every string when
+ *        @param cached is set, so the strings themselves are not read again.
+ *        Without a cache (nullptr) the characters are read from the strings every time.
+ */
+inline void multikeyQuickSort(std::vector<std::string>& array, int *cache,
+                              std::size_t begin, std::size_t end, std::size_t depth, bool cached) {
+    while (end - begin >= SMALL_RANGE) {
+        if (cache && !cached) {
+            for (std::size_t i = begin; i < end; ++i) cache[i] = charAt(array[i], depth);
+        }
+
+        auto key = [&](std::size_t i) { return cache ? cache[i] : charAt(array[i], depth); };
+
+        int a = key(begin), b = key(begin + (end - begin) / 2), c = key(end - 1);
+        int pivot = a < b ? (b < c ? b : (a < c ? c : a)) : (a < c ? a : (b < c ? c : b));
+
+        std::size_t lesser = begin, current = begin, greater = end;
+        while (current < greater) {
+            int character = key(current);
+
+            if (character < pivot) {
+                std::swap(array[lesser], array[current]);
+                if (cache) std::swap(cache[lesser], cache[current]);
+                ++lesser;
+                ++current;
+            } else if (character > pivot) {
+                --greater;
+                std::swap(array[current], array[greater]);
+                if (cache) std::swap(cache[current], cache[greater]);
+            } else {
+                ++current;
+            }
+        }
+
+        multikeyQuickSort(array, cache, begin, lesser, depth, true);
+        multikeyQuickSort(array, cache, greater, end, depth, true);
+
+        if (pivot == 0) return;
+
+        begin = lesser;
+        end = greater;
+        ++depth;
+        cached = false;
+    }
+
+    insertionSort(array, begin, end, depth);
+}
+
+/*
+ * @brief MSD Radix Sort of [@param begin, @param end) at @param depth, moving
+ *        strings through @param buffer. Only the range of characters that actually
+ *        occurs is counted, so small alphabets (digits, hex, DNA) need few buckets.
+ *        The largest bucket is sorted in the same call, so the recursion stays shallow.
+ */
+inline void msdRadixSort(std::vector<std::string>& array, std::string *buffer, int *cache,
+                         std::size_t begin, std::size_t end, std::size_t depth) {
+    while (end - begin >= SMALL_RANGE) {
+        int low = 256, high = 0;
+
+        for (std::size_t i = begin; i < end; ++i) {
+            cache[i] = charAt(array[i], depth);
+            if (cache[i] < low) low = cache[i];
+            if (cache[i] > high) high = cache[i];
+        }
+
+        if (low == high) {
+            if (low == 0) return;
+
+            ++depth;
+            continue;
+        }
+
+        // Bucket b holds the strings with character low + b, and ends at bucketEnd[b]
+        std::size_t buckets = high - low + 1;
+        std::array<std::size_t, 257> bucketEnd{};
+
+        for (std::size_t i = begin; i < end; ++i) ++bucketEnd[cache[i] - low];
+        for (std::size_t bucket = 0, sum = begin; bucket < buckets; ++bucket) {
+            std::size_t count = bucketEnd[bucket];
+            bucketEnd[bucket] = sum;
+            sum += count;
+        }
+
+        for (std::size_t i = begin; i < end; ++i) buffer[bucketEnd[cache[i] - low]++] = std::move(array[i]);
+        for (std::size_t i = begin; i < end; ++i) array[i] = std::move(buffer[i]);
+
+        std::size_t largestBegin = begin, largestEnd = begin;
+
+        for (std::size_t bucket = (low == 0 ? 1 : 0); bucket < buckets; ++bucket) {
+            std::size_t bucketBegin = bucket ? bucketEnd[bucket - 1] : begin;
+
+            if (bucketEnd[bucket] - bucketBegin > largestEnd - largestBegin) {
+                msdRadixSort(array, buffer, cache, largestBegin, largestEnd, depth + 1);
+                largestBegin = bucketBegin;
+                largestEnd = bucketEnd[bucket];
+            } else {
+                msdRadixSort(array, buffer, cache, bucketBegin, bucketEnd[bucket], depth + 1);
+            }
+        }
+
+        begin = largestBegin;
+        end = largestEnd;
+        ++depth;
+    }
+
+    insertionSort(array, begin, end, depth);
+}
+
+/*
+ * @brief LCP Merge Sort of [@param begin, @param end). Afterwards @param lcp[i] holds the
+ *        longest common prefix of array[i] and array[i - 1] (0 for the first string).
+ */
+inline void lcpMergeSort(std::vector<std::string>& array, std::string *buffer,
+                         std::size_t *lcp, std::size_t *lcpBuffer, std::size_t begin, std::size_t end) {
+    if (end - begin <= 1) {
+        if (end > begin) lcp[begin] = 0;
+        return;
+    }
+
+    std::size_t middle = begin + (end - begin) / 2;
+
+    lcpMergeSort(array, buffer, lcp, lcpBuffer, begin, middle);
+    lcpMergeSort(array, buffer, lcp, lcpBuffer, middle, end);
+
+    // leftCommon and rightCommon are the LCPs of the two heads with the last string output
+    std::size_t i = begin, j = middle, out = begin;
+    std::size_t leftCommon = 0, rightCommon = 0;
+
+    auto output = [&](std::size_t& from, std::size_t common) {
+        lcpBuffer[out] = common;
+        buffer[out++] = std::move(array[from++]);
+    };
+
+    while (i < middle && j < end) {
+        if (leftCommon > rightCommon) {
+            output(i, leftCommon);
+            leftCommon = i < middle ? lcp[i] : 0;
+        } else if (rightCommon > leftCommon) {
+            output(j, rightCommon);
+            rightCommon = j < end ? lcp[j] : 0;
+        } else {
+            const std::string& left = array[i];
+            const std::string& right = array[j];
+
+            std::size_t common = leftCommon;
+            while (common < left.size() && common < right.size() && left[common] == right[common]) ++common;
+
+            bool rightFirst = common < left.size() && (common == right.size() ||
+                static_cast<unsigned char>(right[common]) < static_cast<unsigned char>(left[common]));
+
+            if (rightFirst) {
+                output(j, rightCommon);
+                leftCommon = common;
+                rightCommon = j < end ? lcp[j] : 0;
+            } else {
+                output(i, leftCommon);
+                rightCommon = common;
+                leftCommon = i < middle ? lcp[i] : 0;
+            }
+        }
+    }
+
+    if (i < middle) {
+        output(i, leftCommon);
+        while (i < middle) {
+            std::size_t common = lcp[i];
+            output(i, common);
+        }
+    }
+
+    if (j < end) {
+        output(j, rightCommon);
+        while (j < end) {
+            std::size_t common = lcp[j];
+            output(j, common);
+        }
+    }
+
+    for (std::size_t k = begin; k < end; ++k) {
+        array[k] = std::move(buffer[k]);
+        lcp[k] = lcpBuffer[k];
+    }
+
+    lcp[begin] = 0;
+}
+
+} // namespace string_sort
+
+/*
+ * @brief Applies Multikey Quick Sort (three-way radix Quick Sort) in-place on @param array
+ *
+ * @param array Array to be sorted
+ */
+inline void multikeyQuickSort(std::vector<std::string>& array) {
+    std::vector<int> cache(array.size());
+    string_sort::multikeyQuickSort(array, cache.data(), 0, array.size(), 0, false);
+}
+
+/*
+ * @brief Applies Multikey Quick Sort in-place on @param array, caching characters in
+ *        @param workspace instead of allocating. If the cache does not fit, the
+ *        characters are read from the strings every time.
+ *
+ * @param array Array to be sorted
+ * @param workspace Scratch memory to be used
+ */
+inline void multikeyQuickSort(std::vector<std::string>& array, SortWorkspace& workspace) {
+    ScratchBuffer<int> cache = workspace.acquire<int>(array.size());
+    string_sort::multikeyQuickSort(array, cache.size() == array.size() ? cache.data() : nullptr,
+                                   0, array.size(), 0, false);
+}
+
+/*
+ * @brief Applies MSD Radix Sort on @param array
+ *
+ * @param array Array to be sorted
+ */
+inline void msdRadixSort(std::vector<std::string>& array) {
+    std::vector<std::string> buffer(array.size());
+    std::vector<int> cache(array.size());
+    string_sort::msdRadixSort(array, buffer.data(), cache.data(), 0, array.size(), 0);
+}
+
+/*
+ * @brief Applies MSD Radix Sort on @param array, moving the strings through
+ *        @param workspace instead of allocating. If the workspace cannot hold a
+ *        string and a character for every element, Multikey Quick Sort is used.
+ *
+ * @param array Array to be sorted
+ * @param workspace Scratch memory to be used
+ */
+inline void msdRadixSort(std::vector<std::string>& array, SortWorkspace& workspace) {
+    {
+        ScratchBuffer<std::string> buffer = workspace.acquire<std::string>(array.size());
+        ScratchBuffer<int> cache = workspace.acquire<int>(array.size());
+
+        if (buffer.size() == array.size() && cache.size() == array.size()) {
+            string_sort::msdRadixSort(array, buffer.data(), cache.data(), 0, array.size(), 0);
+            return;
+        }
+    }
+
+    multikeyQuickSort(array, workspace);
+}
+
+/*
+ * @brief Applies stable LCP Merge Sort on @param array and returns the LCP array,
+ *        where element i is the longest common prefix of array[i] and array[i - 1]
+ *
+ * @param array Array to be sorted
+ */
+inline std::vector<std::size_t> lcpMergeSort(std::vector<std::string>& array) {
+    std::vector<std::string> buffer(array.size());
+    std::vector<std::size_t> lcp(array.size()), lcpBuffer(array.size());
+    string_sort::lcpMergeSort(array, buffer.data(), lcp.data(), lcpBuffer.data(), 0, array.size());
+
+    return lcp;
+}
+
+/*
+ * @brief Applies stable LCP Merge Sort on @param array, storing the LCP array in
+ *        @param lcp and taking the merge buffers from @param workspace instead of
+ *        allocating. @param lcp only allocates if it has less capacity than
+ *        @param array has elements. If the merge buffers do not fit, the array is
+ *        sorted with In-Place Merge Sort and the LCPs are computed afterwards.
+ *
+ * @param array Array to be sorted
+ * @param lcp Receives the LCP array
+ * @param workspace Scratch memory to be used
+ */
+inline void lcpMergeSort(std::vector<std::string>& array, std::vector<std::size_t>& lcp, SortWorkspace& workspace) {
+    lcp.resize(array.size());
+
+    {
+        ScratchBuffer<std::string> buffer = workspace.acquire<std::string>(array.size());
+        ScratchBuffer<std::size_t> lcpBuffer = workspace.acquire<std::size_t>(array.size());
+
+        if (buffer.size() == array.size() && lcpBuffer.size() == array.size()) {
+            string_sort::lcpMergeSort(array, buffer.data(), lcp.data(), lcpBuffer.data(), 0, array.size());
+            return;
+        }
+    }
+
+    {
+        ScratchBuffer<std::string> buffer = workspace.acquire<std::string>(array.size() / 2 + 1);
+        inPlaceMergeSort(array.begin(), array.end(), buffer.data(), buffer.size());
+    }
+
+    for (std::size_t i = 0; i < array.size(); ++i) {
+        std::size_t common = 0;
+
+        if (i > 0) {
+            const std::string& previous = array[i - 1];
+            while (common < previous.size() && common < array[i].size() && previous[common] == array[i][common]) ++common;
+        }
+
+        lcp[i] = common;
+    }
+}
+
+} // namespace sort
+
+} // namespace algorithms
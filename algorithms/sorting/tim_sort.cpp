@@ -0,0 +1,436 @@
+/*
+ * @file
+ *
+ * @brief Implements Tim Sort Algorithm with the Powersort merge policy (Iterative)
+ *
+ * Algorithm:
+ * 1. Find the next natural run (ascending, or strictly descending which is reversed)
+ * 2. Extend short runs to a minimum length using Binary Insertion Sort
+ * 3. Give the boundary between the previous run and the new one a "power", the depth of
+ *    the boundary's midpoint in a perfectly balanced merge tree
+ * 4. Merge the runs on the stack while the boundary below the top is deeper than the new one
+ * 5. Push the new run, repeat till the end, then merge the remaining runs
+ *
+ * Merges copy the shorter run to a buffer and switch to galloping (exponential search)
+ * when one run keeps winning, so already sorted data costs O(n) comparisons. With a
+ * SortWorkspace, runs too long for its buffer are merged in-place with rotations.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "in_place_merge_sort.cpp"
+#include "sort_workspace.cpp"
+
+/*
+ * @namespace algorithms
+ * @brief Parent namespace for all namespaces of various algorithms
+ */
+namespace algorithms {
+
+/*
+ * @namespace sort
+ * @brief Functions for sorting algorithms
+ */
+namespace sort {
+
+/*
+ * @namespace tim_sort
+ * @brief Helper routines of Tim Sort. Unlike insertionSort and mergeSort, the run
+ *        extension skips the already sorted prefix and binary searches for the
+ *        insertion point, and the merges gallop, so they are separate routines.
+ */
+namespace tim_sort {
+
+/*
+ * @brief Number of consecutive wins before a merge starts galloping
+ */
+constexpr std::size_t MIN_GALLOP = 7;
+
+/*
+ * @brief A run on the merge stack
+ */
+struct Run {
+    std::size_t start;
+    std::size_t length;
+    int power;
+};
+
+/*
+ * @brief Most runs ever on the merge stack. Their powers strictly increase from the
+ *        bottom, and no power exceeds the number of bits of a size.
+ */
+constexpr std::size_t MAX_RUNS = 8 * sizeof(std::size_t) + 2;
+
+/*
+ * @brief Merge buffer that grows to the shorter run of every merge
+ */
+template <typename T>
+struct GrowingBuffer {
+    std::vector<T> elements;
+
+    /*
+     * @brief Moves [@param first, @param last) into the buffer and returns where it starts
+     */
+    template <typename Iterator>
+    T *take(Iterator first, Iterator last) {
+        this->elements.assign(std::make_move_iterator(first), std::make_move_iterator(last));
+        return this->elements.data();
+    }
+
+    T *data() {
+        return this->elements.data();
+    }
+
+    std::size_t size() const {
+        return this->elements.size();
+    }
+};
+
+/*
+ * @brief Merge buffer of fixed size, usually borrowed from a SortWorkspace
+ */
+template <typename T>
+struct FixedBuffer {
+    T *elements;
+    std::size_t count;
+
+    /*
+     * @brief Moves [@param first, @param last) into the buffer and returns where it starts,
+     *        or nullptr if it does not fit
+     */
+    template <typename Iterator>
+    T *take(Iterator first, Iterator last) {
+        if (static_cast<std::size_t>(last - first) > this->count) return nullptr;
+
+        std::move(first, last, this->elements);
+        return this->elements;
+    }
+
+    T *data() {
+        return this->elements;
+    }
+
+    std::size_t size() const {
+        return this->count;
+    }
+};
+
+/*
+ * @brief Returns the minimum run length for an array of @param size elements,
+ *        between 32 and 64 so that size / minRun is close to a power of two
+ */
+inline std::size_t minRunLength(std::size_t size) {
+    std::size_t extra = 0;
+
+    while (size >= 64) {
+        extra |= size & 1;
+        size >>= 1;
+    }
+
+    return size + extra;
+}
+
+/*
+ * @brief Returns the power of the boundary between the run of @param leftLength elements
+ *        starting at @param leftStart and the @param rightLength elements following it
+ *
+ * @param size Size of the whole array
+ */
+inline int nodePower(std::size_t leftStart, std::size_t leftLength, std::size_t rightLength, std::size_t size) {
+    std::size_t a = 2 * leftStart + leftLength;
+    std::size_t b = a + leftLength + rightLength;
+    int power = 0;
+
+    while (true) {
+        ++power;
+
+        if (a >= size) {
+            a -= size;
+            b -= size;
+        } else if (b >= size) {
+            break;
+        }
+
+        a <<= 1;
+        b <<= 1;
+    }
+
+    return power;
+}
+
+/*
+ * @brief Returns the length of the run starting at @param first, reversing it
+ *        in-place if it is strictly descending
+ */
+template <typename Iterator>
+std::size_t countRun(Iterator first, Iterator last) {
+    Iterator it = first + 1;
+    if (it == last) return 1;
+
+    if (*it < *first) {
+        while (it + 1 != last && *(it + 1) < *it) ++it;
+        ++it;
+        std::reverse(first, it);
+    } else {
+        while (it + 1 != last && !(*(it + 1) < *it)) ++it;
+        ++it;
+    }
+
+    return it - first;
+}
+
+/*
+ * @brief Binary Insertion Sort of [@param first, @param last), where
+ *        [@param first, @param sorted) is already sorted
+ */
+template <typename Iterator>
+void binaryInsertionSort(Iterator first, Iterator sorted, Iterator last) {
+    for (Iterator it = sorted; it != last; ++it) {
+        Iterator position = std::upper_bound(first, it, *it);
+        if (position == it) continue;
+
+        auto key = std::move(*it);
+        std::move_backward(position, it, it + 1);
+        *position = std::move(key);
+    }
+}
+
+/*
+ * @brief Galloping search from the left for the first element of
+ *        [@param first, @param last) greater than (@param strict false)
+ *        or not lesser than (@param strict true) @param key
+ */
+template <typename Iterator, typename T>
+Iterator gallopFromLeft(Iterator first, Iterator last, const T& key, bool strict) {
+    std::size_t size = last - first, bound = 1;
+
+    while (bound <= size && (strict ? *(first + bound - 1) < key : !(key < *(first + bound - 1)))) bound *= 2;
+
+    Iterator low = first + bound / 2, high = first + std::min(bound, size);
+    return strict ? std::lower_bound(low, high, key) : std::upper_bound(low, high, key);
+}
+
+/*
+ * @brief Galloping search from the right, same result as gallopFromLeft
+ */
+template <typename Iterator, typename T>
+Iterator gallopFromRight(Iterator first, Iterator last, const T& key, bool strict) {
+    std::size_t size = last - first, bound = 1;
+
+    while (bound <= size && (strict ? !(*(last - bound) < key) : key < *(last - bound))) bound *= 2;
+
+    Iterator low = last - std::min(bound, size), high = last - bound / 2;
+    return strict ? std::lower_bound(low, high, key) : std::upper_bound(low, high, key);
+}
+
+/*
+ * @brief Merges [@param first, @param middle) and [@param middle, @param last)
+ *        when the left run is the shorter one and has been moved to @param buffer
+ */
+template <typename Iterator, typename T>
+void mergeLow(Iterator first, Iterator middle, Iterator last, T *buffer, std::size_t& minGallop) {
+    T *left = buffer, *leftEnd = left + (middle - first);
+    Iterator right = middle, out = first;
+
+    while (left != leftEnd && right != last) {
+        std::size_t leftWins = 0, rightWins = 0;
+
+        while (left != leftEnd && right != last) {
+            if (*right < *left) {
+                *(out++) = std::move(*(right++));
+                leftWins = 0;
+                if (++rightWins >= minGallop) break;
+            } else {
+                *(out++) = std::move(*(left++));
+                rightWins = 0;
+                if (++leftWins >= minGallop) break;
+            }
+        }
+
+        if (left == leftEnd || right == last) break;
+
+        do {
+            T *leftStop = gallopFromLeft(left, leftEnd, *right, false);
+            leftWins = leftStop - left;
+            out = std::move(left, leftStop, out);
+            left = leftStop;
+            if (left == leftEnd) break;
+
+            Iterator rightStop = gallopFromLeft(right, last, *left, true);
+            rightWins = rightStop - right;
+            out = std::move(right, rightStop, out);
+            right = rightStop;
+            if (right == last) break;
+
+            if (minGallop > 1) --minGallop;
+        } while (leftWins >= MIN_GALLOP || rightWins >= MIN_GALLOP);
+
+        ++minGallop;
+    }
+
+    std::move(left, leftEnd, out);
+}
+
+/*
+ * @brief Merges [@param first, @param middle) and [@param middle, @param last)
+ *        when the right run is the shorter one and has been moved to @param buffer
+ */
+template <typename Iterator, typename T>
+void mergeHigh(Iterator first, Iterator middle, Iterator last, T *buffer, std::size_t& minGallop) {
+    T *rightBegin = buffer, *right = rightBegin + (last - middle);
+    Iterator left = middle, out = last;
+
+    while (left != first && right != rightBegin) {
+        std::size_t leftWins = 0, rightWins = 0;
+
+        while (left != first && right != rightBegin) {
+            if (*(right - 1) < *(left - 1)) {
+                *(--out) = std::move(*(--left));
+                rightWins = 0;
+                if (++leftWins >= minGallop) break;
+            } else {
+                *(--out) = std::move(*(--right));
+                leftWins = 0;
+                if (++rightWins >= minGallop) break;
+            }
+        }
+
+        if (left == first || right == rightBegin) break;
+
+        do {
+            Iterator leftStop = gallopFromRight(first, left, *(right - 1), false);
+            leftWins = left - leftStop;
+            out = std::move_backward(leftStop, left, out);
+            left = leftStop;
+            if (left == first) break;
+
+            T *rightStop = gallopFromRight(rightBegin, right, *(left - 1), true);
+            rightWins = right - rightStop;
+            out = std::move_backward(rightStop, right, out);
+            right = rightStop;
+            if (right == rightBegin) break;
+
+            if (minGallop > 1) --minGallop;
+        } while (leftWins >= MIN_GALLOP || rightWins >= MIN_GALLOP);
+
+        ++minGallop;
+    }
+
+    std::move_backward(rightBegin, right, out);
+}
+
+/*
+ * @brief Merges the adjacent sorted runs [@param first, @param middle) and
+ *        [@param middle, @param last), skipping the elements already in place.
+ *        If the shorter run does not fit @param buffer, they are merged in-place.
+ */
+template <typename Iterator, typename Buffer>
+void mergeRuns(Iterator first, Iterator middle, Iterator last, Buffer& buffer, std::size_t& minGallop) {
+    first = gallopFromLeft(first, middle, *middle, false);
+    if (first == middle) return;
+
+    last = gallopFromRight(middle, last, *(middle - 1), true);
+    if (last == middle) return;
+
+    if (middle - first <= last - middle) {
+        if (auto *left = buffer.take(first, middle)) return mergeLow(first, middle, last, left, minGallop);
+    } else {
+        if (auto *right = buffer.take(middle, last)) return mergeHigh(first, middle, last, right, minGallop);
+    }
+
+    inPlaceMerge(first, middle, last, buffer.data(), buffer.size());
+}
+
+/*
+ * @brief Tim Sort of [@param first, @param last), merging through @param buffer
+ */
+template <typename Iterator, typename Buffer>
+void sortRuns(Iterator first, Iterator last, Buffer& buffer) {
+    std::size_t size = last - first;
+    if (size <= 1) return;
+
+    std::size_t minRun = minRunLength(size);
+    std::size_t minGallop = MIN_GALLOP;
+
+    Run runs[MAX_RUNS];
+    std::size_t runCount = 0;
+
+    auto mergeTop = [&]() {
+        Run right = runs[--runCount];
+        Run& left = runs[runCount - 1];
+
+        mergeRuns(first + left.start, first + right.start, first + right.start + right.length, buffer, minGallop);
+        left.length += right.length;
+    };
+
+    for (std::size_t start = 0; start < size;) {
+        std::size_t length = countRun(first + start, last);
+
+        if (length < minRun) {
+            std::size_t extended = std::min(minRun, size - start);
+            binaryInsertionSort(first + start, first + start + length, first + start + extended);
+            length = extended;
+        }
+
+        if (runCount) {
+            int power = nodePower(runs[runCount - 1].start, runs[runCount - 1].length, length, size);
+
+            while (runCount > 1 && runs[runCount - 2].power > power) mergeTop();
+
+            runs[runCount - 1].power = power;
+        }
+
+        runs[runCount++] = {start, length, 0};
+        start += length;
+    }
+
+    while (runCount > 1) mergeTop();
+}
+
+} // namespace tim_sort
+
+/*
+ * @brief Applies stable Tim Sort in-place on the range [@param first, @param last)
+ *
+ * @param first Iterator to the beginning of the range
+ * @param last Iterator past the end of the range
+ */
+template <typename Iterator>
+void timSort(Iterator first, Iterator last) {
+    tim_sort::GrowingBuffer<typename std::iterator_traits<Iterator>::value_type> buffer;
+    tim_sort::sortRuns(first, last, buffer);
+}
+
+/*
+ * @brief Applies stable Tim Sort in-place on @param array
+ *
+ * @param array Array to be sorted
+ */
+template <typename T>
+void timSort(std::vector<T>& array) {
+    timSort(array.begin(), array.end());
+}
+
+/*
+ * @brief Applies stable Tim Sort in-place on @param array, taking its merge buffer
+ *        from @param workspace instead of allocating. Merges whose shorter run does
+ *        not fit the workspace are done in-place with rotations.
+ *
+ * @param array Array to be sorted
+ * @param workspace Scratch memory to be used
+ */
+template <typename T>
+void timSort(std::vector<T>& array, SortWorkspace& workspace) {
+    ScratchBuffer<T> scratch = workspace.acquire<T>(array.size() / 2);
+    tim_sort::FixedBuffer<T> buffer{scratch.data(), scratch.size()};
+
+    tim_sort::sortRuns(array.begin(), array.end(), buffer);
+}
+
+} // namespace sort
+
+} // namespace algorithms
@@ -0,0 +1,62 @@
+/*
+ * @file
+ *
+ * @brief Helpers shared by the benchmark programs
+ *
+ * Every benchmark is a standalone program, built with optimisations, e.g.
+ *     g++ -std=c++20 -O2 benchmarks/tim_sort_benchmark.cpp -o tim_sort_benchmark
+ */
+
+#ifndef BENCHMARKS_BENCHMARK
+#define BENCHMARKS_BENCHMARK
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/*
+ * @namespace benchmark
+ * @brief Timing helpers of the benchmark programs
+ */
+namespace benchmark {
+
+/*
+ * @brief Runs @param function once and returns how long it took in seconds
+ */
+template <typename Function>
+double seconds(Function function) {
+    auto start = std::chrono::steady_clock::now();
+    function();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count();
+}
+
+/*
+ * @brief Sorts a fresh copy of @param input with @param sort @param repetitions times
+ *        and returns the fastest time in seconds. Exits if the result is not sorted.
+ */
+template <typename T, typename Sort>
+double timeSort(const std::vector<T>& input, Sort sort, int repetitions = 3) {
+    double best = 0;
+
+    for (int i = 0; i < repetitions; ++i) {
+        std::vector<T> array = input;
+        double elapsed = seconds([&]() { sort(array); });
+
+        if (!std::is_sorted(array.begin(), array.end())) {
+            std::printf("Result is not sorted.\n");
+            std::exit(1);
+        }
+
+        if (i == 0 || elapsed < best) best = elapsed;
+    }
+
+    return best;
+}
+
+} // namespace benchmark
+
+#endif // BENCHMARKS_BENCHMARK
@@ -0,0 +1,121 @@
+/*
+ * @file
+ *
+ * @brief Compares the d-ary Heap for D = 2, 4 and 8 with std::priority_queue, and
+ *        Heap Sort for the same D with std::make_heap and std::sort_heap
+ *     g++ -std=c++20 -O2 benchmarks/d_ary_heap_benchmark.cpp -o d_ary_heap_benchmark
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "benchmark.cpp"
+#include "../algorithms/sorting/heap_sort.cpp"
+#include "../data_structures/d_ary_heap.cpp"
+
+using data_structures::d_ary_heap::DAryHeap;
+
+using MinQueue = std::priority_queue<std::uint64_t, std::vector<std::uint64_t>, std::greater<std::uint64_t>>;
+
+/*
+ * @brief Seconds to push all of @param values into @param Heap and pop them again
+ */
+template <typename Heap>
+double pushThenPop(const std::vector<std::uint64_t>& values) {
+    std::uint64_t previous = 0;
+
+    double time = benchmark::seconds([&]() {
+        Heap heap;
+        for (std::uint64_t value: values) heap.push(value);
+
+        while (!heap.empty()) {
+            if (heap.top() < previous) {
+                std::printf("Popped out of order.\n");
+                std::exit(1);
+            }
+
+            previous = heap.top();
+            heap.pop();
+        }
+    });
+
+    return time;
+}
+
+/*
+ * @brief Seconds to keep the @param keep largest of @param values, replacing the
+ *        smallest kept one whenever a larger value arrives
+ */
+template <typename Heap, typename Replace>
+double topK(const std::vector<std::uint64_t>& values, std::size_t keep, Replace replace) {
+    return benchmark::seconds([&]() {
+        Heap heap;
+        for (std::size_t i = 0; i < keep; ++i) heap.push(values[i]);
+
+        for (std::size_t i = keep; i < values.size(); ++i) {
+            if (heap.top() < values[i]) replace(heap, values[i]);
+        }
+    });
+}
+
+/*
+ * @brief DAryHeap with the member names of std::priority_queue
+ */
+template <std::size_t D>
+struct Adapted : DAryHeap<std::uint64_t, D> {
+    void push(std::uint64_t value) { DAryHeap<std::uint64_t, D>::push(value); }
+    void pop() { DAryHeap<std::uint64_t, D>::pop(); }
+    bool empty() const { return this->isEmpty(); }
+};
+
+int main() {
+    const std::size_t SIZE = 4000000;
+    const std::size_t KEEP = 100000;
+    std::mt19937_64 generator(1);
+
+    std::vector<std::uint64_t> values(SIZE);
+    for (auto& value: values) value = generator();
+
+    auto replaceTop = [](auto& heap, std::uint64_t value) {
+        heap.pop();
+        heap.push(value);
+    };
+    auto pushPop = [](auto& heap, std::uint64_t value) { heap.pushPop(value); };
+
+    std::printf("%zu random uint64_t, seconds\n", SIZE);
+    std::printf("%-28s %10s %10s %10s %18s\n", "", "D = 2", "D = 4", "D = 8", "std::priority_queue");
+
+    std::printf("%-28s %10.3f %10.3f %10.3f %18.3f\n", "push all, then pop all", pushThenPop<Adapted<2>>(values),
+                pushThenPop<Adapted<4>>(values), pushThenPop<Adapted<8>>(values), pushThenPop<MinQueue>(values));
+
+    std::printf("%-28s %10.3f %10.3f %10.3f %18.3f\n", "top 100000, pop and push", topK<Adapted<2>>(values, KEEP, replaceTop),
+                topK<Adapted<4>>(values, KEEP, replaceTop), topK<Adapted<8>>(values, KEEP, replaceTop),
+                topK<MinQueue>(values, KEEP, replaceTop));
+
+    std::printf("%-28s %10.3f %10.3f %10.3f %18s\n", "top 100000, pushPop", topK<Adapted<2>>(values, KEEP, pushPop),
+                topK<Adapted<4>>(values, KEEP, pushPop), topK<Adapted<8>>(values, KEEP, pushPop), "-");
+
+    using algorithms::sort::heapSort;
+    auto heapSortWith = [](auto d) {
+        return [](std::vector<std::uint64_t>& array) { heapSort<decltype(d)::value>(array); };
+    };
+
+    std::printf("%-28s %10.3f %10.3f %10.3f %18.3f\n", "heapSort / std::sort_heap",
+                benchmark::timeSort(values, heapSortWith(std::integral_constant<std::size_t, 2>())),
+                benchmark::timeSort(values, heapSortWith(std::integral_constant<std::size_t, 4>())),
+                benchmark::timeSort(values, heapSortWith(std::integral_constant<std::size_t, 8>())),
+                benchmark::timeSort(values, [](std::vector<std::uint64_t>& array) {
+                    std::make_heap(array.begin(), array.end());
+                    std::sort_heap(array.begin(), array.end());
+                }));
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+/*
+ * @file
+ *
+ * @brief Compares the time and peak extra heap memory of the stable sorts
+ *
+ * The global allocation functions are replaced by ones that track the bytes in use,
+ * so the peak heap memory a sort needs on top of its input can be reported (Linux only).
+ *     g++ -std=c++20 -O2 benchmarks/in_place_merge_sort_benchmark.cpp -o in_place_merge_sort_benchmark
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <malloc.h>
+#include <new>
+#include <random>
+#include <vector>
+
+#include "benchmark.cpp"
+#include "../algorithms/sorting/in_place_merge_sort.cpp"
+#include "../algorithms/sorting/merge_sort.cpp"
+
+static std::size_t bytesInUse = 0;
+static std::size_t peakBytes = 0;
+
+// Not inlined, so GCC does not mistake the std::free for a mismatched deallocation
+[[gnu::noinline]] void *operator new(std::size_t size) {
+    void *pointer = std::malloc(size ? size : 1);
+    if (!pointer) throw std::bad_alloc();
+
+    bytesInUse += malloc_usable_size(pointer);
+    peakBytes = std::max(peakBytes, bytesInUse);
+
+    return pointer;
+}
+
+[[gnu::noinline]] void operator delete(void *pointer) noexcept {
+    if (!pointer) return;
+
+    bytesInUse -= malloc_usable_size(pointer);
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+    operator delete(pointer);
+}
+
+using namespace algorithms::sort;
+
+/*
+ * @brief Prints the time and peak extra heap memory of @param sort on @param input
+ */
+template <typename Sort>
+void report(const char *name, const std::vector<int>& input, Sort sort) {
+    std::vector<int> array = input;
+
+    std::size_t before = bytesInUse;
+    peakBytes = bytesInUse;
+    sort(array);
+    std::size_t peak = peakBytes - before;
+
+    double elapsed = benchmark::timeSort(input, sort);
+    std::printf("%-34s %8.3f s %12.1f KiB\n", name, elapsed, peak / 1024.0);
+}
+
+int main() {
+    const std::size_t SIZE = 2000000;
+
+    std::mt19937 generator(1);
+    std::vector<int> input(SIZE);
+    for (int& value: input) value = static_cast<int>(generator());
+
+    std::size_t root = static_cast<std::size_t>(std::sqrt(static_cast<double>(SIZE)));
+
+    std::printf("%zu random ints, time and peak extra heap memory\n", SIZE);
+
+    report("mergeSort", input, [](std::vector<int>& array) { mergeSort(array); });
+    report("std::stable_sort", input, [](std::vector<int>& array) {
+        std::stable_sort(array.begin(), array.end());
+    });
+    report("inPlaceMergeSort, no buffer", input, [](std::vector<int>& array) { inPlaceMergeSort(array); });
+    report("inPlaceMergeSort, sqrt(n) buffer", input, [root](std::vector<int>& array) {
+        std::vector<int> buffer(root);
+        inPlaceMergeSort(array, buffer);
+    });
+    report("inPlaceMergeSort, 2048 buffer", input, [](std::vector<int>& array) {
+        std::vector<int> buffer(2048);
+        inPlaceMergeSort(array, buffer);
+    });
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+/*
+ * @file
+ *
+ * @brief Measures the LRU Cache under Zipfian key popularity, against the textbook
+ *        std::list and std::unordered_map cache. Every lookup that misses inserts the key.
+ *     g++ -std=c++20 -O2 benchmarks/lru_cache_benchmark.cpp -o lru_cache_benchmark
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <list>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "benchmark.cpp"
+#include "../data_structures/lru_cache.cpp"
+
+using data_structures::lru_cache::LRUCache;
+
+/*
+ * @brief LRU cache holding its entries in a std::list, allocating on every insertion
+ */
+class ListCache {
+    private:
+        std::list<std::pair<std::uint64_t, std::uint64_t>> entries;
+        std::unordered_map<std::uint64_t, decltype(entries)::iterator> index;
+        std::size_t capacity;
+
+    public:
+        ListCache(std::size_t capacity) : capacity(capacity) {
+            this->index.reserve(capacity);
+        }
+
+        std::uint64_t *get(std::uint64_t key) {
+            auto found = this->index.find(key);
+            if (found == this->index.end()) return nullptr;
+
+            this->entries.splice(this->entries.begin(), this->entries, found->second);
+            return &found->second->second;
+        }
+
+        void put(std::uint64_t key, std::uint64_t value) {
+            if (this->entries.size() == this->capacity) {
+                this->index.erase(this->entries.back().first);
+                this->entries.pop_back();
+            }
+
+            this->entries.emplace_front(key, value);
+            this->index.emplace(key, this->entries.begin());
+        }
+};
+
+/*
+ * @brief Returns @param count keys out of @param universe, key k being drawn with
+ *        probability proportional to 1 / (k + 1)^@param exponent
+ */
+std::vector<std::uint64_t> zipfianKeys(std::size_t count, std::size_t universe, double exponent, std::mt19937_64& generator) {
+    std::vector<double> cumulative(universe);
+    double sum = 0;
+
+    for (std::size_t k = 0; k < universe; ++k) cumulative[k] = sum += 1 / std::pow(k + 1, exponent);
+
+    // Scatter the popular keys over the key space, so hashing them is not trivially cheap
+    std::vector<std::uint64_t> names(universe);
+    for (std::size_t k = 0; k < universe; ++k) names[k] = generator();
+
+    std::uniform_real_distribution<double> uniform(0, sum);
+    std::vector<std::uint64_t> keys(count);
+
+    for (auto& key: keys) {
+        std::size_t k = std::lower_bound(cumulative.begin(), cumulative.end(), uniform(generator)) - cumulative.begin();
+        key = names[std::min(k, universe - 1)];
+    }
+
+    return keys;
+}
+
+/*
+ * @brief Runs @param keys through @param cache, returning the hit rate and the
+ *        millions of operations per second
+ */
+template <typename Cache>
+std::pair<double, double> run(Cache& cache, const std::vector<std::uint64_t>& keys) {
+    std::size_t hits = 0;
+
+    double time = benchmark::seconds([&]() {
+        for (std::uint64_t key: keys) {
+            if (cache.get(key)) ++hits;
+            else cache.put(key, key);
+        }
+    });
+
+    return {static_cast<double>(hits) / keys.size(), keys.size() / time / 1e6};
+}
+
+int main() {
+    const std::size_t OPERATIONS = 10000000;
+    const std::size_t UNIVERSE = 1000000;
+    std::mt19937_64 generator(1);
+
+    std::printf("%zu lookups over %zu keys, a miss inserts the key\n", OPERATIONS, UNIVERSE);
+    std::printf("%-9s %-9s %10s %14s %14s\n", "exponent", "capacity", "hit rate", "LRUCache Mops", "std::list Mops");
+
+    for (double exponent: {0.6, 0.8, 1.0, 1.2}) {
+        std::vector<std::uint64_t> keys = zipfianKeys(OPERATIONS, UNIVERSE, exponent, generator);
+
+        for (std::size_t capacity: {std::size_t(1000), std::size_t(10000), std::size_t(100000)}) {
+            LRUCache<std::uint64_t, std::uint64_t> cache(capacity);
+            ListCache list(capacity);
+
+            auto [hitRate, pooled] = run(cache, keys);
+            auto [listHitRate, listed] = run(list, keys);
+
+            if (hitRate != listHitRate) {
+                std::printf("hit rates differ: %f and %f\n", hitRate, listHitRate);
+                return 1;
+            }
+
+            std::printf("%-9.1f %-9zu %10.3f %14.1f %14.1f\n", exponent, capacity, hitRate, pooled, listed);
+        }
+    }
+
+    return 0;
+}
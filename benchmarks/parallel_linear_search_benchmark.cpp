@@ -0,0 +1,90 @@
+/*
+ * @file
+ *
+ * @brief Measures how Parallel Linear Search scales with the number of threads,
+ *        for matches near the start, in the middle, near the end and absent.
+ *        Also times small arrays, to check the SEQUENTIAL_BYTES threshold
+ *     g++ -std=c++20 -O2 -pthread benchmarks/parallel_linear_search_benchmark.cpp -o parallel_linear_search_benchmark
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "benchmark.cpp"
+#include "../algorithms/searching/parallel_linear_search.cpp"
+
+using namespace algorithms::search;
+
+/*
+ * @brief Returns the best of @param repetitions times of searching @param array
+ *        for @param item on @param threads threads, exiting if the index is wrong
+ */
+double timeSearch(const std::vector<int32_t>& array, int32_t item, std::size_t expected, unsigned threads,
+                  int repetitions) {
+    double best = 0;
+
+    for (int i = 0; i < repetitions; ++i) {
+        std::size_t index = 0;
+        double time = benchmark::seconds([&]() { index = parallelLinearSearch(array, item, threads); });
+
+        if (index != expected) {
+            std::printf("wrong index %zu, expected %zu\n", index, expected);
+            std::exit(1);
+        }
+
+        if (i == 0 || time < best) best = time;
+    }
+
+    return best;
+}
+
+int main() {
+    const std::size_t SIZE = 64 * 1024 * 1024;
+    const std::size_t NOT_FOUND = -1;
+    const int32_t ITEM = -1;
+
+    unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> threadCounts;
+    for (unsigned threads = 1; threads < hardware; threads *= 2) threadCounts.push_back(threads);
+    threadCounts.push_back(hardware);
+
+    std::vector<int32_t> array(SIZE);
+    for (std::size_t i = 0; i < SIZE; ++i) array[i] = static_cast<int32_t>(i & 0x7fffffff);
+
+    std::printf("%zu int32_t, milliseconds\n", SIZE);
+    std::printf("%-8s %10s %10s %10s %10s %10s\n", "threads", "start", "10%", "50%", "90%", "none");
+
+    for (unsigned threads: threadCounts) {
+        std::printf("%-8u", threads);
+
+        for (std::size_t position: {std::size_t(1000), SIZE / 10, SIZE / 2, SIZE / 10 * 9, NOT_FOUND}) {
+            if (position != NOT_FOUND) array[position] = ITEM;
+            double time = timeSearch(array, ITEM, position, threads, 5);
+            if (position != NOT_FOUND) array[position] = static_cast<int32_t>(position);
+
+            std::printf(" %10.3f", time * 1000);
+        }
+
+        std::printf("\n");
+    }
+
+    // Sizes around SEQUENTIAL_BYTES, searched for an absent item
+    std::printf("\nsmall arrays, microseconds, %u threads against 1\n", hardware);
+    std::printf("%-10s %10s %10s\n", "bytes", "1 thread", "threads");
+
+    for (std::size_t bytes = 64 * 1024; bytes <= 16 * 1024 * 1024; bytes *= 2) {
+        std::vector<int32_t> small(array.begin(), array.begin() + bytes / sizeof(int32_t));
+
+        double sequential = timeSearch(small, ITEM, NOT_FOUND, 1, 50);
+        double parallel = timeSearch(small, ITEM, NOT_FOUND, hardware, 50);
+
+        std::printf("%-10zu %10.1f %10.1f\n", bytes, sequential * 1e6, parallel * 1e6);
+    }
+
+    return 0;
+}
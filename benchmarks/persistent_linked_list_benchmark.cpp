@@ -0,0 +1,159 @@
+/*
+ * @file
+ *
+ * @brief Compares O(1) snapshots of a Persistent Linked List with copying a
+ *        std::vector under a mutex on every snapshot
+ *
+ * 1. Cost of one snapshot and of reading it in full, for growing list sizes
+ * 2. A writer inserting and deleting at the front while reader threads keep taking
+ *    snapshots, reporting the writer's throughput
+ *     g++ -std=c++20 -O2 -pthread benchmarks/persistent_linked_list_benchmark.cpp -o persistent_linked_list_benchmark
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "benchmark.cpp"
+#include "../data_structures/persistent_linked_list.cpp"
+
+using data_structures::persistent_linked_list::AtomicPersistentLinkedList;
+using data_structures::persistent_linked_list::PersistentLinkedList;
+
+/*
+ * @brief Vector shared by readers and writers, copied whole for every snapshot
+ */
+class CopiedVector {
+    private:
+        mutable std::mutex mutex;
+        std::vector<int> values;
+
+    public:
+        std::vector<int> snapshot() const {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            return this->values;
+        }
+
+        // The front is the back of the vector, so both versions change in O(1)
+        void insert(int value) {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->values.push_back(value);
+        }
+
+        void deleteFromBeginning() {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->values.pop_back();
+        }
+};
+
+/*
+ * @brief Time in microseconds of one snapshot and of one full read, averaged over
+ *        @param repetitions, for lists of @param size elements
+ */
+void reportSnapshots(std::size_t size, int repetitions) {
+    AtomicPersistentLinkedList list;
+    CopiedVector vector;
+
+    for (std::size_t i = 0; i < size; ++i) {
+        list.insert(static_cast<int>(i));
+        vector.insert(static_cast<int>(i));
+    }
+
+    std::size_t found = 0;
+    std::vector<PersistentLinkedList> snapshots;
+    std::vector<std::vector<int>> copies;
+    snapshots.reserve(repetitions);
+    copies.reserve(repetitions);
+
+    // Every snapshot is kept alive, as a reader holding on to old versions would
+    double persistent = benchmark::seconds([&]() {
+        for (int i = 0; i < repetitions; ++i) snapshots.push_back(list.snapshot());
+    });
+    double copied = benchmark::seconds([&]() {
+        for (int i = 0; i < repetitions; ++i) copies.push_back(vector.snapshot());
+    });
+
+    // A full read, searching for a missing value, follows pointers through the list
+    // against scanning a contiguous copy
+    const PersistentLinkedList& version = snapshots.back();
+    const std::vector<int>& copy = copies.back();
+
+    double walk = benchmark::seconds([&]() {
+        for (int i = 0; i < repetitions; ++i) found += version.search(-1 - i);
+    });
+    double scan = benchmark::seconds([&]() {
+        for (int i = 0; i < repetitions; ++i) found += std::find(copy.begin(), copy.end(), -1 - i) != copy.end();
+    });
+
+    if (found) std::printf("found a missing value\n");
+
+    std::printf("%-10zu %14.3f %14.3f %14.1f %14.1f\n", size, persistent / repetitions * 1e6,
+                copied / repetitions * 1e6, walk / repetitions * 1e6, scan / repetitions * 1e6);
+}
+
+/*
+ * @brief Writer operations per microsecond while @param readers threads keep taking
+ *        snapshots of a @param size element @param Shared and reading their front
+ */
+template <typename Shared, typename Read>
+double writerThroughput(std::size_t size, unsigned readers, Read read) {
+    const int OPERATIONS = 200000;
+
+    Shared shared;
+    for (std::size_t i = 0; i < size; ++i) shared.insert(static_cast<int>(i));
+
+    std::atomic<bool> done{false};
+    std::atomic<long long> reads{0};
+    std::vector<std::thread> threads;
+
+    for (unsigned i = 0; i < readers; ++i) {
+        threads.emplace_back([&]() {
+            long long count = 0;
+            while (!done.load(std::memory_order_relaxed)) count += read(shared);
+            reads += count;
+        });
+    }
+
+    double time = benchmark::seconds([&]() {
+        for (int i = 0; i < OPERATIONS; ++i) {
+            shared.insert(i);
+            shared.deleteFromBeginning();
+        }
+    });
+
+    done = true;
+    for (auto& thread: threads) thread.join();
+
+    return 2 * OPERATIONS / time / 1e6;
+}
+
+int main() {
+    std::printf("microseconds per snapshot and per full read of it\n");
+    std::printf("%-10s %14s %14s %14s %14s\n", "size", "persistent", "vector copy", "list read", "vector read");
+
+    for (std::size_t size: {std::size_t(100), std::size_t(10000), std::size_t(1000000)}) {
+        reportSnapshots(size, size >= 1000000 ? 20 : 1000);
+    }
+
+    unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> readerCounts = {0, 1};
+    if (hardware > 2) readerCounts.push_back(hardware - 1);
+
+    std::printf("\nwriter million operations per second with readers snapshotting a 10000 element list\n");
+    std::printf("%-10s %14s %14s\n", "readers", "persistent", "vector copy");
+
+    for (unsigned readers: readerCounts) {
+        double persistent = writerThroughput<AtomicPersistentLinkedList>(10000, readers,
+            [](const AtomicPersistentLinkedList& list) { return list.snapshot().isEmpty() ? 0 : 1; });
+        double copied = writerThroughput<CopiedVector>(10000, readers,
+            [](const CopiedVector& vector) { return vector.snapshot().empty() ? 0 : 1; });
+
+        std::printf("%-10u %14.2f %14.2f\n", readers, persistent, copied);
+    }
+
+    return 0;
+}
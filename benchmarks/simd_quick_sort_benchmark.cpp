@@ -0,0 +1,69 @@
+/*
+ * @file
+ *
+ * @brief Compares the vectorised Quick Sort at each instruction set level with
+ *        std::sort, for std::int32_t, std::int64_t and float. Levels the CPU does
+ *        not support fall back to the highest one it does.
+ *     g++ -std=c++20 -O2 benchmarks/simd_quick_sort_benchmark.cpp -o simd_quick_sort_benchmark
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "benchmark.cpp"
+#include "../algorithms/sorting/quick_sort.cpp"
+
+using namespace algorithms::sort;
+
+/*
+ * @brief Prints the times of every level and std::sort on @param input
+ */
+template <typename T>
+void report(const char *name, const std::vector<T>& input) {
+    auto level = [](simd::Level level) {
+        return [level](std::vector<T>& array) { simd::sort(array.data(), array.size(), level); };
+    };
+
+    double scalar = benchmark::timeSort(input, level(simd::Level::Scalar));
+    double avx2 = benchmark::timeSort(input, level(simd::Level::AVX2));
+    double avx512 = benchmark::timeSort(input, level(simd::Level::AVX512));
+    double standard = benchmark::timeSort(input, [](std::vector<T>& array) { std::sort(array.begin(), array.end()); });
+
+    std::printf("%-22s %10.3f %10.3f %10.3f %10.3f\n", name, scalar, avx2, avx512, standard);
+}
+
+/*
+ * @brief Prints the times for @param size random and few distinct values of type @param T
+ */
+template <typename T>
+void reportType(const char *name, std::size_t size, std::mt19937_64& generator) {
+    std::vector<T> random(size), duplicates(size);
+
+    for (std::size_t i = 0; i < size; ++i) {
+        random[i] = static_cast<T>(static_cast<std::int64_t>(generator()) >> (64 - 8 * sizeof(T)));
+        duplicates[i] = static_cast<T>(generator() % 16);
+    }
+
+    std::printf("%s\n", name);
+    report("  random", random);
+    report("  16 distinct values", duplicates);
+}
+
+int main() {
+    const std::size_t SIZE = 10000000;
+    std::mt19937_64 generator(1);
+
+    const char *levels[] = {"Scalar", "AVX2", "AVX512"};
+    std::printf("%zu elements, seconds, CPU supports up to %s\n", SIZE, levels[static_cast<int>(simd::detectLevel())]);
+    std::printf("%-22s %10s %10s %10s %10s\n", "", "Scalar", "AVX2", "AVX512", "std::sort");
+
+    reportType<std::int32_t>("int32_t", SIZE, generator);
+    reportType<std::int64_t>("int64_t", SIZE, generator);
+    reportType<float>("float", SIZE, generator);
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+/*
+ * @file
+ *
+ * @brief Compares the string sorts with the comparison sorts on corpora with long
+ *        shared prefixes: URLs of a few sites, and "key:" followed by a hex number
+ *     g++ -std=c++20 -O2 benchmarks/string_sort_benchmark.cpp -o string_sort_benchmark
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark.cpp"
+#include "../algorithms/sorting/merge_sort.cpp"
+#include "../algorithms/sorting/quick_sort.cpp"
+#include "../algorithms/sorting/string_sort.cpp"
+
+using namespace algorithms::sort;
+
+using Strings = std::vector<std::string>;
+
+/*
+ * @brief Prints the times of every sort on @param input
+ */
+void report(const char *name, const Strings& input) {
+    double merge = benchmark::timeSort(input, [](Strings& array) { mergeSort(array); });
+    double quick = benchmark::timeSort(input, [](Strings& array) { quickSort(array.begin(), array.end()); });
+    double standard = benchmark::timeSort(input, [](Strings& array) { std::sort(array.begin(), array.end()); });
+    double multikey = benchmark::timeSort(input, [](Strings& array) { multikeyQuickSort(array); });
+    double radix = benchmark::timeSort(input, [](Strings& array) { msdRadixSort(array); });
+    double lcp = benchmark::timeSort(input, [](Strings& array) { lcpMergeSort(array); });
+
+    std::printf("%-10s %10.3f %10.3f %10.3f %10.3f %10.3f %10.3f\n", name, merge, quick, standard, multikey, radix, lcp);
+}
+
+int main() {
+    const std::size_t SIZE = 500000;
+    std::mt19937_64 generator(1);
+
+    const char *sites[] = {"https://www.example.com/", "https://en.wikipedia.org/wiki/", "https://github.com/",
+                           "http://news.example.org/articles/"};
+    const char *sections[] = {"users/", "projects/", "blog/2024/", "docs/reference/", "search?q="};
+
+    Strings urls(SIZE), keys(SIZE);
+
+    for (std::size_t i = 0; i < SIZE; ++i) {
+        urls[i] = std::string(sites[generator() % 4]) + sections[generator() % 5] + std::to_string(generator() % 1000000);
+
+        char hex[17];
+        std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(generator()));
+        keys[i] = "key:" + std::string(hex);
+    }
+
+    std::printf("%zu strings, seconds\n", SIZE);
+    std::printf("%-10s %10s %10s %10s %10s %10s %10s\n", "", "mergeSort", "quickSort", "std::sort", "multikey", "MSD radix",
+                "LCP merge");
+
+    report("URLs", urls);
+    report("key:hex", keys);
+
+    return 0;
+}
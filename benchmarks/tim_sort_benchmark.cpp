@@ -0,0 +1,68 @@
+/*
+ * @file
+ *
+ * @brief Compares Tim Sort with Merge Sort and std::stable_sort on partially
+ *        sorted distributions
+ *     g++ -std=c++20 -O2 benchmarks/tim_sort_benchmark.cpp -o tim_sort_benchmark
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "benchmark.cpp"
+#include "../algorithms/sorting/merge_sort.cpp"
+#include "../algorithms/sorting/tim_sort.cpp"
+
+using namespace algorithms::sort;
+
+/*
+ * @brief Prints the times of the stable sorts on @param input
+ */
+void report(const char *name, const std::vector<int>& input) {
+    double merge = benchmark::timeSort(input, [](std::vector<int>& array) { mergeSort(array); });
+    double tim = benchmark::timeSort(input, [](std::vector<int>& array) { timSort(array); });
+    double standard = benchmark::timeSort(input, [](std::vector<int>& array) {
+        std::stable_sort(array.begin(), array.end());
+    });
+
+    std::printf("%-20s %10.3f %10.3f %18.3f\n", name, merge, tim, standard);
+}
+
+int main() {
+    const std::size_t SIZE = 2000000;
+    std::mt19937 generator(1);
+
+    std::vector<int> random(SIZE);
+    for (int& value: random) value = static_cast<int>(generator());
+
+    std::vector<int> sorted = random;
+    std::sort(sorted.begin(), sorted.end());
+
+    std::vector<int> reversed(sorted.rbegin(), sorted.rend());
+
+    std::vector<int> swapped = sorted;
+    for (int i = 0; i < 1000; ++i) std::swap(swapped[generator() % SIZE], swapped[generator() % SIZE]);
+
+    std::vector<int> appended(sorted.begin(), sorted.begin() + SIZE - SIZE / 100);
+    for (std::size_t i = 0; i < SIZE / 100; ++i) appended.push_back(static_cast<int>(generator()));
+
+    std::vector<int> batches = random;
+    for (std::size_t batch = 0; batch < 16; ++batch) {
+        std::sort(batches.begin() + batch * SIZE / 16, batches.begin() + (batch + 1) * SIZE / 16);
+    }
+
+    std::printf("%zu ints, seconds\n", SIZE);
+    std::printf("%-20s %10s %10s %18s\n", "distribution", "mergeSort", "timSort", "std::stable_sort");
+
+    report("random", random);
+    report("sorted", sorted);
+    report("reversed", reversed);
+    report("sorted, 1000 swaps", swapped);
+    report("sorted, 1% appended", appended);
+    report("16 sorted batches", batches);
+
+    return 0;
+}
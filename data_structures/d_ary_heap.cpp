@@ -0,0 +1,315 @@
+/*
+ * @file
+ *
+ * @brief Implementation of d-ary Min Heap (Priority Queue)
+ *
+ * Every node has D children instead of 2, which halves the height of the heap for D = 4.
+ * The storage is padded so that the children of a node start at a multiple of D, and
+ * aligned so that each group of siblings sits in as few cache lines as possible.
+ * Every pushed element gets a handle, through which its key can later be decreased.
+ * Handles of removed elements are reused with a new generation, so a stale handle
+ * is never taken for the element that got its index after it.
+ * The padding slots need T to be default constructible.
+ */
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+/*
+ * @namespace
+ *
+ * @brief Parent namespace for namespaces of various data structures
+ */
+namespace data_structures {
+
+/*
+ * @namespace d_ary_heap
+ *
+ * @brief Implementation of d-ary Heaps
+ */
+namespace d_ary_heap {
+
+/*
+ * @brief Allocator returning memory aligned to @param ALIGNMENT bytes
+ */
+template <typename T, std::size_t ALIGNMENT>
+struct AlignedAllocator {
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, ALIGNMENT>;
+    };
+
+    AlignedAllocator() = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, ALIGNMENT>&) {}
+
+    T *allocate(std::size_t count) {
+        return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t(ALIGNMENT)));
+    }
+
+    void deallocate(T *pointer, std::size_t) {
+        ::operator delete(pointer, std::align_val_t(ALIGNMENT));
+    }
+
+    bool operator==(const AlignedAllocator&) const { return true; }
+    bool operator!=(const AlignedAllocator&) const { return false; }
+};
+
+/*
+ * @brief Identifies an element pushed into a heap, for decreaseKey
+ */
+struct Handle {
+    std::size_t index;
+    std::size_t generation;
+
+    bool operator==(const Handle&) const = default;
+};
+
+template <typename T, std::size_t D = 4, typename Compare = std::less<T>>
+class DAryHeap {
+    static_assert(D >= 2, "A heap needs at least 2 children per node.");
+
+    private:
+        struct Entry {
+            T value;
+            std::size_t index;
+        };
+
+        static constexpr std::size_t PADDING = D - 1;
+        static constexpr std::size_t ALIGNMENT = D * sizeof(Entry) <= 64 ? D * sizeof(Entry) : 64;
+
+        // Entries live at [PADDING, PADDING + count), the children of slot i at D * (i - PADDING + 1) onwards
+        std::vector<Entry, AlignedAllocator<Entry, (ALIGNMENT & (ALIGNMENT - 1)) == 0 ? ALIGNMENT : alignof(Entry)>> slots;
+        // Indexed by the index of a handle
+        std::vector<std::size_t> position;
+        std::vector<std::size_t> generation;
+        std::vector<std::size_t> freeHandles;
+        std::size_t count;
+        Compare less;
+
+        static constexpr std::size_t NOT_IN_HEAP = static_cast<std::size_t>(-1);
+
+        static std::size_t _parent(std::size_t slot) {
+            return (slot - PADDING - 1) / D + PADDING;
+        }
+
+        static std::size_t _firstChild(std::size_t slot) {
+            return D * (slot - PADDING + 1);
+        }
+
+        void _place(std::size_t slot, Entry entry) {
+            this->position[entry.index] = slot;
+            this->slots[slot] = std::move(entry);
+        }
+
+        void _siftUp(std::size_t slot) {
+            Entry entry = std::move(this->slots[slot]);
+
+            while (slot > PADDING) {
+                std::size_t parent = _parent(slot);
+                if (!this->less(entry.value, this->slots[parent].value)) break;
+
+                _place(slot, std::move(this->slots[parent]));
+                slot = parent;
+            }
+
+            _place(slot, std::move(entry));
+        }
+
+        void _siftDown(std::size_t slot) {
+            Entry entry = std::move(this->slots[slot]);
+            std::size_t end = PADDING + this->count;
+
+            while (true) {
+                std::size_t first = _firstChild(slot);
+                if (first >= end) break;
+
+                std::size_t last = first + D < end ? first + D : end;
+                std::size_t smallest = first;
+
+                for (std::size_t child = first + 1; child < last; ++child) {
+                    if (this->less(this->slots[child].value, this->slots[smallest].value)) smallest = child;
+                }
+
+                if (!this->less(this->slots[smallest].value, entry.value)) break;
+
+                _place(slot, std::move(this->slots[smallest]));
+                slot = smallest;
+            }
+
+            _place(slot, std::move(entry));
+        }
+
+        Handle _newHandle() {
+            if (!this->freeHandles.empty()) {
+                std::size_t index = this->freeHandles.back();
+                this->freeHandles.pop_back();
+                return {index, this->generation[index]};
+            }
+
+            this->position.push_back(NOT_IN_HEAP);
+            this->generation.push_back(0);
+            return {this->position.size() - 1, 0};
+        }
+
+        /*
+         * @brief Marks the element with handle index @param index as removed. The
+         *        index is reused by a later handle, of the next generation.
+         */
+        void _releaseHandle(std::size_t index) {
+            this->position[index] = NOT_IN_HEAP;
+            this->generation[index]++;
+            this->freeHandles.push_back(index);
+        }
+
+    public:
+        DAryHeap(Compare less = Compare()) : slots(PADDING), count(0), less(less) {}
+
+        /*
+         * @brief Builds a heap from @param values in O(n). The element at index i
+         *        of @param values gets handle {i, 0}.
+         */
+        DAryHeap(std::vector<T> values, Compare less = Compare()) : count(values.size()), less(less) {
+            this->slots.reserve(PADDING + values.size());
+            this->slots.resize(PADDING);
+            this->position.resize(values.size());
+            this->generation.resize(values.size(), 0);
+
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                this->slots.push_back({std::move(values[i]), i});
+                this->position[i] = PADDING + i;
+            }
+
+            heapify();
+        }
+
+        /*
+         * @brief Restores the heap property over all elements bottom-up, in O(n)
+         */
+        void heapify() {
+            if (this->count <= 1) return;
+
+            for (std::size_t slot = _parent(PADDING + this->count - 1) + 1; slot-- > PADDING;) _siftDown(slot);
+        }
+
+        /*
+         * @brief Inserts @param value
+         *
+         * @return handle of the inserted element
+         */
+        Handle push(T value) {
+            Handle handle = _newHandle();
+
+            this->slots.push_back({std::move(value), handle.index});
+            this->count++;
+            _siftUp(PADDING + this->count - 1);
+
+            return handle;
+        }
+
+        /*
+         * @brief Returns the smallest element
+         *
+         * @throws std::underflow_error if the heap is empty
+         */
+        const T& top() const {
+            if (!this->count) throw std::underflow_error("Heap is empty.");
+
+            return this->slots[PADDING].value;
+        }
+
+        /*
+         * @brief Removes and returns the smallest element
+         *
+         * @throws std::underflow_error if the heap is empty
+         */
+        T pop() {
+            if (!this->count) throw std::underflow_error("Heap is empty. Cannot pop.");
+
+            Entry root = std::move(this->slots[PADDING]);
+            _releaseHandle(root.index);
+
+            this->count--;
+            if (this->count) {
+                this->slots[PADDING] = std::move(this->slots.back());
+                this->slots.pop_back();
+                _siftDown(PADDING);
+            } else {
+                this->slots.pop_back();
+            }
+
+            return std::move(root.value);
+        }
+
+        /*
+         * @brief Inserts @param value and then removes and returns the smallest element,
+         *        with a single sift. If @param value is returned it is never stored.
+         *        Otherwise the handle of the returned element stops being valid, and
+         *        @param value gets a new handle which is not reported, so its key cannot
+         *        be decreased later. Use push and pop to keep track of it.
+         */
+        T pushPop(T value) {
+            if (!this->count || !this->less(this->slots[PADDING].value, value)) return value;
+
+            Entry& root = this->slots[PADDING];
+            T smallest = std::move(root.value);
+
+            _releaseHandle(root.index);
+
+            root = {std::move(value), _newHandle().index};
+            _siftDown(PADDING);
+
+            return smallest;
+        }
+
+        /*
+         * @brief Lowers the value of the element with @param handle to @param value
+         *
+         * @throws std::out_of_range if @param handle is not in the heap
+         * @throws std::invalid_argument if @param value is greater than the current value
+         */
+        void decreaseKey(Handle handle, T value) {
+            if (!contains(handle)) throw std::out_of_range("Handle is not in the heap.");
+
+            std::size_t slot = this->position[handle.index];
+            if (this->less(this->slots[slot].value, value)) throw std::invalid_argument("New value is greater than the current one.");
+
+            this->slots[slot].value = std::move(value);
+            _siftUp(slot);
+        }
+
+        /*
+         * @brief Returns if the element with @param handle is still in the heap.
+         *        False once it has been popped, even if its index is in use again.
+         */
+        bool contains(Handle handle) const {
+            return handle.index < this->position.size() && this->generation[handle.index] == handle.generation &&
+                   this->position[handle.index] != NOT_IN_HEAP;
+        }
+
+        /*
+         * @brief Number of elements in the heap
+         */
+        std::size_t size() const {
+            return this->count;
+        }
+
+        /*
+         * @brief Returns if the heap is empty or not
+         */
+        bool isEmpty() const {
+            return !this->count;
+        }
+};
+
+} // namespace d_ary_heap
+
+} // namespace data_structures
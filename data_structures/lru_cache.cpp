@@ -0,0 +1,306 @@
+/*
+ * @file
+ *
+ * @brief Implementation of a Least Recently Used (LRU) Cache
+ *
+ * Entries are kept in a doubly linked list ordered by recency, with a hash index from
+ * key to node, so lookups, insertions and evictions are all O(1). Nodes come from a
+ * pool sized to the capacity and are reused after eviction. The key and value of an
+ * evicted or erased entry are destroyed right away, only the node itself is kept.
+ *
+ * Only the nodes are pooled: the std::unordered_map index still allocates a node of
+ * its own on every insertion of a new key, so put is not allocation-free.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+/*
+ * @namespace
+ *
+ * @brief Parent namespace for namespaces of various data structures
+ */
+namespace data_structures {
+
+/*
+ * @namespace lru_cache
+ *
+ * @brief Implementation of LRU Cache
+ */
+namespace lru_cache {
+
+/*
+ * @brief Hit, miss and throughput counters of a cache
+ */
+struct Statistics {
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+    std::size_t insertions = 0;
+    std::size_t evictions = 0;
+    std::chrono::steady_clock::time_point since = std::chrono::steady_clock::now();
+
+    /*
+     * @brief Fraction of lookups that were hits
+     */
+    double hitRate() const {
+        std::size_t lookups = hits + misses;
+        return lookups ? static_cast<double>(hits) / lookups : 0.0;
+    }
+
+    /*
+     * @brief Lookups and insertions per second since the counters were last reset
+     */
+    double operationRate() const {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - since;
+        return elapsed.count() > 0 ? (hits + misses + insertions) / elapsed.count() : 0.0;
+    }
+};
+
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class LRUCache {
+    private:
+        struct Node {
+            std::optional<Key> key;
+            std::optional<Value> value;
+            std::size_t bytes;
+            Node *previous;
+            Node *next;
+
+            Node(const Key& key, Value value, std::size_t bytes)
+                : key(key), value(std::move(value)), bytes(bytes), previous(nullptr), next(nullptr) {}
+        };
+
+        std::vector<Node> pool;
+        Node *freeList;
+
+        Node *head;
+        Node *tail;
+
+        std::unordered_map<Key, Node *, Hash> index;
+
+        std::size_t capacity;
+        std::size_t maxBytes;
+        std::size_t bytes;
+
+        std::function<void(const Key&, const Value&)> onEvict;
+        Statistics statistics;
+
+        void _unlink(Node *node) {
+            if (node->previous) node->previous->next = node->next;
+            else this->head = node->next;
+
+            if (node->next) node->next->previous = node->previous;
+            else this->tail = node->previous;
+        }
+
+        void _pushFront(Node *node) {
+            node->previous = nullptr;
+            node->next = this->head;
+
+            if (this->head) this->head->previous = node;
+            else this->tail = node;
+
+            this->head = node;
+        }
+
+        Node *_allocate(const Key& key, Value value, std::size_t bytes) {
+            if (this->freeList) {
+                Node *node = this->freeList;
+                this->freeList = node->next;
+
+                node->key.emplace(key);
+                node->value.emplace(std::move(value));
+                node->bytes = bytes;
+                return node;
+            }
+
+            this->pool.emplace_back(key, std::move(value), bytes);
+            return &this->pool.back();
+        }
+
+        void _release(Node *node) {
+            this->index.erase(*node->key);
+            this->bytes -= node->bytes;
+            node->key.reset();
+            node->value.reset();
+
+            node->next = this->freeList;
+            this->freeList = node;
+        }
+
+    public:
+        /*
+         * @brief Creates a cache holding at most @param capacity entries and, if
+         *        @param maxBytes is not 0, at most @param maxBytes bytes of entries
+         *
+         * @throws std::invalid_argument if @param capacity is 0
+         */
+        LRUCache(std::size_t capacity, std::size_t maxBytes = 0)
+            : freeList(nullptr), head(nullptr), tail(nullptr), capacity(capacity), maxBytes(maxBytes), bytes(0) {
+            if (capacity == 0) throw std::invalid_argument("Cache capacity must be greater than 0.");
+
+            this->pool.reserve(capacity);
+            this->index.reserve(capacity);
+        }
+
+        LRUCache(const LRUCache&) = delete;
+        LRUCache& operator=(const LRUCache&) = delete;
+
+        /*
+         * @brief Sets @param callback to be called with every entry evicted to make room
+         */
+        void setEvictionCallback(std::function<void(const Key&, const Value&)> callback) {
+            this->onEvict = std::move(callback);
+        }
+
+        /*
+         * @brief Looks up @param key, marking it as most recently used
+         *
+         * @return pointer to the cached value, or nullptr if @param key is not cached.
+         *         The pointer is valid until the entry is evicted or erased.
+         */
+        Value *get(const Key& key) {
+            auto found = this->index.find(key);
+
+            if (found == this->index.end()) {
+                this->statistics.misses++;
+                return nullptr;
+            }
+
+            this->statistics.hits++;
+
+            Node *node = found->second;
+            if (node != this->head) {
+                _unlink(node);
+                _pushFront(node);
+            }
+
+            return &*node->value;
+        }
+
+        /*
+         * @brief Inserts or replaces the value of @param key as the most recently used
+         *        entry, evicting the least recently used ones to stay within the limits
+         *
+         * @param key key of the entry
+         * @param value value of the entry
+         * @param size size of the entry in bytes, counted against the byte limit
+         *
+         * @throws std::invalid_argument if @param size alone exceeds the byte limit
+         */
+        void put(const Key& key, Value value, std::size_t size = 0) {
+            if (this->maxBytes && size > this->maxBytes) throw std::invalid_argument("Entry is larger than the cache.");
+
+            this->statistics.insertions++;
+
+            auto found = this->index.find(key);
+
+            if (found != this->index.end()) {
+                Node *node = found->second;
+                this->bytes += size - node->bytes;
+
+                *node->value = std::move(value);
+                node->bytes = size;
+
+                if (node != this->head) {
+                    _unlink(node);
+                    _pushFront(node);
+                }
+            } else {
+                if (this->index.size() == this->capacity) evict();
+
+                Node *node = _allocate(key, std::move(value), size);
+                this->bytes += size;
+                this->index.emplace(key, node);
+                _pushFront(node);
+            }
+
+            while (this->maxBytes && this->bytes > this->maxBytes) evict();
+        }
+
+        /*
+         * @brief Evicts the least recently used entry, calling the eviction callback
+         *
+         * @throws std::underflow_error if the cache is empty
+         */
+        void evict() {
+            if (!this->tail) throw std::underflow_error("Cache is empty. Cannot evict.");
+
+            Node *node = this->tail;
+            _unlink(node);
+
+            this->statistics.evictions++;
+            if (this->onEvict) this->onEvict(*node->key, *node->value);
+
+            _release(node);
+        }
+
+        /*
+         * @brief Removes @param key from the cache without calling the eviction callback
+         *
+         * @return true if @param key was cached
+         */
+        bool erase(const Key& key) {
+            auto found = this->index.find(key);
+            if (found == this->index.end()) return false;
+
+            Node *node = found->second;
+            _unlink(node);
+            _release(node);
+
+            return true;
+        }
+
+        /*
+         * @brief Returns if @param key is cached, without changing its recency
+         */
+        bool contains(const Key& key) const {
+            return this->index.count(key) != 0;
+        }
+
+        /*
+         * @brief Number of cached entries
+         */
+        std::size_t size() const {
+            return this->index.size();
+        }
+
+        /*
+         * @brief Total size in bytes of the cached entries
+         */
+        std::size_t byteSize() const {
+            return this->bytes;
+        }
+
+        /*
+         * @brief Returns if the cache is empty or not
+         */
+        bool isEmpty() const {
+            return !this->head;
+        }
+
+        /*
+         * @brief Returns the hit, miss and throughput counters
+         */
+        const Statistics& stats() const {
+            return this->statistics;
+        }
+
+        /*
+         * @brief Resets the hit, miss and throughput counters
+         */
+        void resetStats() {
+            this->statistics = Statistics();
+        }
+};
+
+} // namespace lru_cache
+
+} // namespace data_structures
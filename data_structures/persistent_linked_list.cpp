@@ -0,0 +1,301 @@
+/*
+ * @file
+ *
+ * @brief Implementation of Persistent (immutable) Singly Linked List
+ *
+ * Operations never modify a list, they return a new version instead. The new version
+ * shares every node after the change with the old one, so keeping old versions around
+ * (snapshots) costs O(1). Nodes are reference counted with std::shared_ptr, whose
+ * counters are atomic, so versions can be read from several threads at once.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+/*
+ * @namespace
+ *
+ * @brief Parent namespace for namespaces of various data structures
+ */
+namespace data_structures {
+
+/*
+ * @namespace persistent_linked_list
+ *
+ * @brief Implementations of Persistent Singly Linked Lists
+ */
+namespace persistent_linked_list {
+
+struct Node {
+    int data;
+    std::size_t length;
+
+    // Only the destructor changes next, to take over the chain of a node it is about to destroy
+    mutable std::shared_ptr<const Node> next;
+
+    Node(int val, std::shared_ptr<const Node> next)
+        : data(val), length(next ? next->length + 1 : 1), next(std::move(next)) {}
+
+    /*
+     * Releases the chain of nodes only this node refers to one by one, so
+     * destroying a long list does not recurse once per node.
+     */
+    ~Node() {
+        std::shared_ptr<const Node> chain = std::move(this->next);
+
+        while (chain && chain.use_count() == 1) {
+            // use_count() is a relaxed load. Synchronise with the release of the last
+            // reference held by another thread before destroying the node it read.
+            // ThreadSanitizer in GCC 12 does not support standalone fences, so it
+            // cannot check this.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            chain = std::move(chain->next);
+        }
+    }
+};
+
+class PersistentLinkedList {
+    private:
+        std::shared_ptr<const Node> head;
+
+        explicit PersistentLinkedList(std::shared_ptr<const Node> head) : head(std::move(head)) {}
+
+        /*
+         * @brief Copies the first @param count nodes in front of @param tail
+         */
+        std::shared_ptr<const Node> _copyPrefix(std::size_t count, std::shared_ptr<const Node> tail) const {
+            std::vector<int> prefix;
+            prefix.reserve(count);
+
+            const Node *temp = this->head.get();
+            for (std::size_t i = 0; i < count; ++i) {
+                prefix.push_back(temp->data);
+                temp = temp->next.get();
+            }
+
+            for (auto it = prefix.rbegin(); it != prefix.rend(); ++it) {
+                tail = std::make_shared<const Node>(*it, std::move(tail));
+            }
+
+            return tail;
+        }
+
+        friend class AtomicPersistentLinkedList;
+
+    public:
+        PersistentLinkedList() = default;
+
+        /*
+         * @brief Returns a new version with @param value inserted at the beginning, in O(1)
+         *
+         * @param value value to be inserted
+         */
+        PersistentLinkedList insert(int value) const {
+            return PersistentLinkedList(std::make_shared<const Node>(value, this->head));
+        }
+
+        /*
+         * @brief Returns a new version with @param value inserted at @param index.
+         *        The first @param index nodes are copied, the rest are shared.
+         *
+         * @param value value to be inserted
+         * @param index index at which @param value is to be inserted
+         *
+         * @throws std::out_of_range if index is greater than list size
+         */
+        PersistentLinkedList insertAt(int value, std::size_t index) const {
+            if (index > length()) throw std::out_of_range("Insert requested at out of bounds index.");
+
+            const Node *temp = this->head.get();
+            std::shared_ptr<const Node> tail = this->head;
+
+            for (std::size_t i = 0; i < index; ++i) {
+                tail = temp->next;
+                temp = temp->next.get();
+            }
+
+            return PersistentLinkedList(_copyPrefix(index, std::make_shared<const Node>(value, std::move(tail))));
+        }
+
+        /*
+         * @brief Returns a new version without the first value, in O(1)
+         *
+         * @throws std::underflow_error if Linked List is empty
+         */
+        PersistentLinkedList deleteFromBeginning() const {
+            if (!this->head) throw std::underflow_error("List is empty. Cannot delete from beginning.");
+
+            return PersistentLinkedList(this->head->next);
+        }
+
+        /*
+         * @brief Returns a new version without the value at @param index.
+         *        The first @param index nodes are copied, the rest are shared.
+         *
+         * @param index Index at which the value is to be deleted
+         *
+         * @throws std::out_of_range if index is greater than list size
+         */
+        PersistentLinkedList deleteAt(std::size_t index) const {
+            if (index >= length()) throw std::out_of_range("delete requested at out of bounds index.");
+
+            const Node *temp = this->head.get();
+            for (std::size_t i = 0; i < index; ++i) temp = temp->next.get();
+
+            return PersistentLinkedList(_copyPrefix(index, temp->next));
+        }
+
+        /*
+         * @brief Displays the entire Linked List
+         */
+        void display() const {
+            const Node *temp = this->head.get();
+
+            while (temp) {
+                std::cout << temp->data << " ";
+                temp = temp->next.get();
+            }
+
+            std::cout << std::endl;
+        }
+
+        /*
+         * @brief Length of the Linked List, in O(1)
+         */
+        std::size_t length() const {
+            return this->head ? this->head->length : 0;
+        }
+
+        /*
+         * @brief Searches if @param value is in the list
+         */
+        bool search(int value) const {
+            const Node *temp = this->head.get();
+
+            while (temp) {
+                if (value == temp->data) {
+                    return true;
+                }
+                temp = temp->next.get();
+            }
+
+            return false;
+        }
+
+        /*
+         * @brief Gets the value stored at @param index
+         *
+         * @throws std::out_of_range if @param index is greater than list size
+         */
+        int getValueAt(std::size_t index) const {
+            const Node *temp = this->head.get();
+            std::size_t count = 0;
+
+            while (temp) {
+                if (count == index) {
+                    return temp->data;
+                }
+                temp = temp->next.get();
+                count++;
+            }
+
+            throw std::out_of_range("Value requested at out of bounds index.");
+        }
+
+        /*
+         * @brief Returns if the list is empty or not
+         */
+        bool isEmpty() const {
+            return !this->head;
+        }
+
+        /*
+         * @brief Returns the first element of the list
+         *
+         * @throws std::underflow_error if the list is empty.
+         */
+        int front() const {
+            if (this->head) return this->head->data;
+            throw std::underflow_error("List is empty.");
+        }
+};
+
+/*
+ * @brief Holds the current version of a Persistent Linked List for one or more
+ *        writers and any number of readers. Readers take O(1) snapshots that stay
+ *        valid and unchanged however the list is modified afterwards.
+ *
+ * This is not lock-free. libstdc++ implements std::atomic<std::shared_ptr> with a
+ * lock bit in the pointer, held while the pointer is loaded or swapped and its
+ * reference count adjusted. A reader taking a snapshot can spin behind a writer or
+ * another reader in that short section, and all of them stall if a thread is
+ * preempted while holding it. Only taking a snapshot and publishing are locked:
+ * reading a snapshot touches immutable nodes and needs no synchronisation.
+ */
+class AtomicPersistentLinkedList {
+    private:
+        std::atomic<std::shared_ptr<const Node>> current;
+
+        /*
+         * @brief Replaces the current version with @param update applied to it,
+         *        retrying if another writer got there first
+         */
+        template <typename Update>
+        void _modify(Update update) {
+            std::shared_ptr<const Node> expected = this->current.load();
+
+            while (!this->current.compare_exchange_weak(expected, update(PersistentLinkedList(expected)).head));
+        }
+
+    public:
+        AtomicPersistentLinkedList() = default;
+
+        /*
+         * @brief Returns the current version of the list, in O(1)
+         */
+        PersistentLinkedList snapshot() const {
+            return PersistentLinkedList(this->current.load());
+        }
+
+        /*
+         * @brief Makes @param list the current version
+         */
+        void publish(const PersistentLinkedList& list) {
+            this->current.store(list.head);
+        }
+
+        /*
+         * @brief Inserts @param value at the beginning
+         */
+        void insert(int value) {
+            _modify([value](const PersistentLinkedList& list) { return list.insert(value); });
+        }
+
+        /*
+         * @brief Deletes the value from the beginning
+         *
+         * @throws std::underflow_error if Linked List is empty
+         */
+        void deleteFromBeginning() {
+            _modify([](const PersistentLinkedList& list) { return list.deleteFromBeginning(); });
+        }
+
+        /*
+         * @brief Deletes the value at @param index
+         *
+         * @throws std::out_of_range if index is greater than list size
+         */
+        void deleteAt(std::size_t index) {
+            _modify([index](const PersistentLinkedList& list) { return list.deleteAt(index); });
+        }
+};
+
+} // namespace persistent_linked_list
+
+} // namespace data_structures
@@ -0,0 +1,61 @@
+/*
+ * @file
+ *
+ * @brief Compile time tests of the constexpr sorting and searching algorithms
+ *
+ * Every check is a static_assert, so the tests pass if this file compiles:
+ *     g++ -std=c++20 tests/constexpr_test.cpp
+ */
+
+#include <array>
+#include <cstddef>
+
+#include "../algorithms/searching/binary_search.cpp"
+#include "../algorithms/searching/linear_search.cpp"
+#include "../algorithms/sorting/insertion_sort.cpp"
+#include "../algorithms/sorting/merge_sort.cpp"
+#include "../algorithms/sorting/quick_sort.cpp"
+
+using algorithms::search::binarySearch;
+using algorithms::search::linearSeach;
+using algorithms::sort::insertionSorted;
+using algorithms::sort::mergeSorted;
+using algorithms::sort::quickSorted;
+
+constexpr std::size_t NOT_FOUND = -1;
+
+constexpr std::array<int, 10> unsorted = {5, -3, 9, 0, 5, 12, -7, 3, 9, 1};
+constexpr std::array<int, 10> sorted = {-7, -3, 0, 1, 3, 5, 5, 9, 9, 12};
+
+static_assert(insertionSorted(unsorted) == sorted);
+static_assert(mergeSorted(unsorted) == sorted);
+static_assert(quickSorted(unsorted) == sorted);
+
+// Edge cases: empty, single element, already sorted, reversed, all equal
+static_assert(quickSorted(std::array<int, 0>{}) == std::array<int, 0>{});
+static_assert(mergeSorted(std::array<int, 1>{4}) == std::array<int, 1>{4});
+static_assert(insertionSorted(sorted) == sorted);
+static_assert(quickSorted(std::array<int, 5>{5, 4, 3, 2, 1}) == std::array<int, 5>{1, 2, 3, 4, 5});
+static_assert(mergeSorted(std::array<int, 5>{5, 4, 3, 2, 1}) == std::array<int, 5>{1, 2, 3, 4, 5});
+static_assert(quickSorted(std::array<int, 4>{2, 2, 2, 2}) == std::array<int, 4>{2, 2, 2, 2});
+
+// A lookup table built at compile time
+constexpr std::array<int, 10> table = quickSorted(unsorted);
+
+static_assert(binarySearch(table, -7) == 0);
+static_assert(binarySearch(table, 12) == 9);
+static_assert(binarySearch(table, 3) == 4);
+static_assert(binarySearch(table, 2) == NOT_FOUND);
+static_assert(binarySearch(table, -8) == NOT_FOUND);
+static_assert(binarySearch(table, 13) == NOT_FOUND);
+static_assert(binarySearch(std::array<int, 0>{}, 1) == NOT_FOUND);
+
+static_assert(linearSeach(unsorted, 5) == 0);
+static_assert(linearSeach(unsorted, 1) == 9);
+static_assert(linearSeach(unsorted, 9) == 2);
+static_assert(linearSeach(unsorted, 4) == NOT_FOUND);
+static_assert(linearSeach(std::array<int, 0>{}, 1) == NOT_FOUND);
+
+int main() {
+    return 0;
+}
@@ -0,0 +1,96 @@
+/*
+ * @file
+ *
+ * @brief Tests the vectorised Quick Sort at every instruction set level against std::sort
+ *
+ * Levels the CPU does not support fall back to the highest one it does, which is
+ * printed. Covers sizes around the register widths and the leaf size, runs of
+ * duplicates, the extreme values of each type and infinities:
+ *     g++ -std=c++20 tests/simd_quick_sort_test.cpp && ./a.out
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "../algorithms/sorting/quick_sort.cpp"
+
+using namespace algorithms::sort;
+
+static int failures = 0;
+
+/*
+ * @brief Sorts a copy of @param input at @param level and checks it against std::sort
+ */
+template <typename T>
+void check(const char *name, simd::Level level, const std::vector<T>& input) {
+    std::vector<T> expected = input;
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<T> array = input;
+    simd::sort(array.data(), array.size(), level);
+
+    if (array != expected) {
+        std::printf("FAIL %s, level %d, size %zu\n", name, static_cast<int>(level), input.size());
+        ++failures;
+    }
+}
+
+/*
+ * @brief Runs the checks for one element type at every level, mixing the values
+ *        of @param special into some of the inputs
+ */
+template <typename T>
+void checkType(const char *name, const std::vector<T>& special, std::mt19937& generator) {
+    std::vector<std::size_t> sizes;
+    for (std::size_t size = 0; size <= 130; ++size) sizes.push_back(size);
+    for (std::size_t size: {255, 256, 257, 1000, 4095, 4096, 4097, 20000}) sizes.push_back(size);
+
+    for (simd::Level level: {simd::Level::Scalar, simd::Level::AVX2, simd::Level::AVX512}) {
+        for (std::size_t size: sizes) {
+            std::vector<T> random(size), duplicates(size), extremes(size), equal(size, special[0]);
+
+            for (std::size_t i = 0; i < size; ++i) {
+                random[i] = static_cast<T>(static_cast<std::int32_t>(generator()) / 4);
+                duplicates[i] = static_cast<T>(generator() % 4);
+                extremes[i] = generator() % 2 ? special[generator() % special.size()] : random[i];
+            }
+
+            std::vector<T> sorted = random, reversed = random;
+            std::sort(sorted.begin(), sorted.end());
+            std::sort(reversed.rbegin(), reversed.rend());
+
+            check(name, level, random);
+            check(name, level, duplicates);
+            check(name, level, extremes);
+            check(name, level, equal);
+            check(name, level, sorted);
+            check(name, level, reversed);
+        }
+    }
+}
+
+int main() {
+    std::mt19937 generator(42);
+
+    using Int32 = std::numeric_limits<std::int32_t>;
+    using Int64 = std::numeric_limits<std::int64_t>;
+    using Float = std::numeric_limits<float>;
+
+    checkType<std::int32_t>("int32_t", {Int32::max(), Int32::min(), 0, -1, Int32::max() - 1}, generator);
+    checkType<std::int64_t>("int64_t", {Int64::max(), Int64::min(), 0, -1, Int32::max(), Int32::min()}, generator);
+    checkType<float>("float", {Float::infinity(), -Float::infinity(), Float::max(), Float::lowest(),
+                               Float::min(), Float::denorm_min(), 0.0f, -0.0f}, generator);
+
+    const char *levels[] = {"Scalar", "AVX2", "AVX512"};
+    std::printf("Highest level supported by the CPU: %s\n", levels[static_cast<int>(simd::detectLevel())]);
+
+    if (failures) return 1;
+
+    std::printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,157 @@
+/*
+ * @file
+ *
+ * @brief Tests that the sorts taking a SortWorkspace do not allocate
+ *
+ * The global allocation functions are replaced by counting ones. Every sort is run
+ * once to warm up, then again on fresh input while the allocations are counted,
+ * for workspace budgets of 0 bytes, 256 bytes and 1 MiB:
+ *     g++ -std=c++20 tests/sort_workspace_test.cpp && ./a.out
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../algorithms/sorting/merge_sort.cpp"
+#include "../algorithms/sorting/quick_sort.cpp"
+#include "../algorithms/sorting/string_sort.cpp"
+#include "../algorithms/sorting/tim_sort.cpp"
+
+static std::size_t allocations = 0;
+
+void *operator new(std::size_t size) {
+    ++allocations;
+    if (void *pointer = std::malloc(size ? size : 1)) return pointer;
+    throw std::bad_alloc();
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+    ++allocations;
+    std::size_t align = static_cast<std::size_t>(alignment);
+    if (void *pointer = std::aligned_alloc(align, (size + align - 1) / align * align)) return pointer;
+    throw std::bad_alloc();
+}
+
+void *operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    ++allocations;
+    return std::malloc(size ? size : 1);
+}
+
+void *operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void operator delete(void *pointer) noexcept { std::free(pointer); }
+void operator delete(void *pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete(void *pointer, const std::nothrow_t&) noexcept { std::free(pointer); }
+void operator delete(void *pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete[](void *pointer) noexcept { std::free(pointer); }
+void operator delete[](void *pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete[](void *pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete[](void *pointer, std::size_t, std::align_val_t) noexcept { std::free(pointer); }
+
+using namespace algorithms::sort;
+
+struct Record {
+    int key;
+    int payload;
+
+    bool operator<(const Record& other) const { return key < other.key; }
+    bool operator==(const Record& other) const { return key == other.key && payload == other.payload; }
+};
+
+static int failures = 0;
+
+/*
+ * @brief Sorts a copy of @param input with @param sort twice, and checks that the
+ *        second run allocates nothing and matches @param expected
+ */
+template <typename T, typename Sort>
+void check(const char *name, std::size_t budget, const std::vector<T>& input, const std::vector<T>& expected, Sort sort) {
+    std::vector<T> array = input;
+    sort(array);
+
+    array = input;
+    std::size_t before = allocations;
+    sort(array);
+    std::size_t counted = allocations - before;
+
+    if (counted != 0 || array != expected) {
+        std::printf("FAIL %s, budget %zu: %zu allocations, %s\n", name, budget, counted,
+                    array == expected ? "sorted" : "not sorted");
+        ++failures;
+    }
+}
+
+int main() {
+    std::mt19937 generator(42);
+    const std::size_t SIZE = 5000;
+
+    std::vector<int> integers(SIZE);
+    std::vector<double> doubles(SIZE);
+    std::vector<Record> records(SIZE);
+    std::vector<std::string> strings(SIZE);
+
+    for (std::size_t i = 0; i < SIZE; ++i) {
+        integers[i] = static_cast<int>(generator() % 1000);
+        doubles[i] = static_cast<double>(generator() % 1000) / 8;
+        records[i] = {static_cast<int>(generator() % 100), static_cast<int>(i)};
+        strings[i] = "key:" + std::to_string(generator() % 100000) + std::string(generator() % 40, 'x');
+    }
+
+    std::vector<int> sortedIntegers = integers;
+    std::vector<double> sortedDoubles = doubles;
+    std::vector<Record> sortedRecords = records;
+    std::vector<std::string> sortedStrings = strings;
+
+    std::sort(sortedIntegers.begin(), sortedIntegers.end());
+    std::sort(sortedDoubles.begin(), sortedDoubles.end());
+    std::stable_sort(sortedRecords.begin(), sortedRecords.end());
+    std::sort(sortedStrings.begin(), sortedStrings.end());
+
+    std::vector<std::size_t> lcp;
+    lcp.reserve(SIZE);
+
+    for (std::size_t budget: {std::size_t(0), std::size_t(256), std::size_t(1024 * 1024)}) {
+        SortWorkspace workspace(budget);
+
+        auto merge = [&](auto& array) { mergeSort(array, workspace); };
+        auto quick = [&](auto& array) { quickSort(array, workspace); };
+        auto tim = [&](auto& array) { timSort(array, workspace); };
+
+        check("mergeSort<int>", budget, integers, sortedIntegers, merge);
+        check("mergeSort<Record>", budget, records, sortedRecords, merge);
+        check("mergeSort<std::string>", budget, strings, sortedStrings, merge);
+
+        check("quickSort<int>", budget, integers, sortedIntegers, quick);
+        check("quickSort<double>", budget, doubles, sortedDoubles, quick);
+        check("quickSort<std::string>", budget, strings, sortedStrings, quick);
+
+        check("timSort<int>", budget, integers, sortedIntegers, tim);
+        check("timSort<Record>", budget, records, sortedRecords, tim);
+        check("timSort<std::string>", budget, strings, sortedStrings, tim);
+
+        check("multikeyQuickSort", budget, strings, sortedStrings,
+              [&](auto& array) { multikeyQuickSort(array, workspace); });
+        check("msdRadixSort", budget, strings, sortedStrings,
+              [&](auto& array) { msdRadixSort(array, workspace); });
+        check("lcpMergeSort", budget, strings, sortedStrings,
+              [&](auto& array) { lcpMergeSort(array, lcp, workspace); });
+    }
+
+    if (failures) return 1;
+
+    std::printf("All tests passed\n");
+    return 0;
+}